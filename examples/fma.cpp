@@ -2,6 +2,7 @@
 #include <hmpc/comp/tensor.hpp>
 #include <hmpc/ints/literals.hpp>
 #include <hmpc/ints/mod.hpp>
+#include <hmpc/ints/simd_mod.hpp>
 
 #include <fmt/format.h>
 #include <sycl/sycl.hpp>
@@ -15,6 +16,8 @@ auto main(int argc, char** raw_argv) -> int
     constexpr auto p = 0x95d13129b10a9d6e4bfc74319391cce9_int; // 199'141'158'556'603'165'496'448'001'566'829'563'113
 
     using mod_p = hmpc::ints::mod<p>;
+    constexpr hmpc::size lanes = 8;
+    using simd_mod_p = hmpc::ints::simd_mod<p, lanes>;
 
     std::size_t N = 10'000'000;
     std::vector<std::string_view> argv(raw_argv, raw_argv + argc);
@@ -27,6 +30,11 @@ auto main(int argc, char** raw_argv) -> int
     {
         std::from_chars(argv[2].data(), argv[2].data() + argv[2].size(), processors);
     }
+    bool use_simd = true;
+    if (argc > 3)
+    {
+        use_simd = (argv[3] != "scalar");
+    }
 
     auto a_tensor = hmpc::comp::make_tensor<mod_p>(hmpc::shape{N});
     auto b_tensor = hmpc::comp::make_tensor<mod_p>(hmpc::shape{N});
@@ -60,10 +68,32 @@ auto main(int argc, char** raw_argv) -> int
         hmpc::comp::device_accessor c(c_tensor, handler, hmpc::access::read);
         hmpc::comp::device_accessor x(x_tensor, handler, hmpc::access::discard_write);
 
-        handler.parallel_for(sycl::range{N}, [=](hmpc::size i)
+        if (use_simd)
         {
-            x[i] = a[i] * b[i] + c[i];
-        });
+            handler.parallel_for(sycl::range{hmpc::detail::div_ceil(N, lanes)}, [=](hmpc::size id)
+            {
+                auto i = id * lanes;
+                if (i + lanes <= N)
+                {
+                    auto result = simd_mod_p::load(a, i) * simd_mod_p::load(b, i) + simd_mod_p::load(c, i);
+                    result.store(x, i);
+                }
+                else
+                {
+                    for (; i < N; ++i)
+                    {
+                        x[i] = a[i] * b[i] + c[i];
+                    }
+                }
+            });
+        }
+        else
+        {
+            handler.parallel_for(sycl::range{N}, [=](hmpc::size i)
+            {
+                x[i] = a[i] * b[i] + c[i];
+            });
+        }
     });
     queue.wait();
     auto end = std::chrono::high_resolution_clock::now();
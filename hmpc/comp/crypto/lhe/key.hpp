@@ -1,6 +1,8 @@
 #pragma once
 
 #include <hmpc/comp/tensor.hpp>
+#include <hmpc/core/limb_array.hpp>
+#include <hmpc/random/number_generator.hpp>
 
 namespace hmpc::comp::crypto::lhe
 {
@@ -10,4 +12,17 @@ namespace hmpc::comp::crypto::lhe
         hmpc::comp::tensor<Poly> a;
         hmpc::comp::tensor<Poly> b;
     };
+
+    /// # Seed-compressed key
+    /// The uniformly random component `a` is given by a `seed` (the key of `Engine`) and expanded on demand (see `hmpc::expr::crypto::lhe::seeded_a`).
+    /// Only `seed` and `b` need to be stored or sent.
+    template<typename Poly, hmpc::random::engine Engine = hmpc::default_random_engine>
+    struct compressed_key
+    {
+        using engine_type = Engine;
+        using limb_type = engine_type::value_type;
+
+        hmpc::core::limb_array<engine_type::key_size, limb_type> seed;
+        hmpc::comp::tensor<Poly> b;
+    };
 }
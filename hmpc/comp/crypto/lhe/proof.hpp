@@ -0,0 +1,18 @@
+#pragma once
+
+#include <hmpc/comp/crypto/lhe/ciphertext.hpp>
+#include <hmpc/comp/crypto/lhe/randomness.hpp>
+#include <hmpc/comp/tensor.hpp>
+
+namespace hmpc::comp::crypto::lhe
+{
+    /// # Proof of plaintext knowledge
+    /// Commitment (encrypted masks), and responses for the plaintexts (`z`) and the randomness (`t`) of the masks.
+    template<typename Poly, hmpc::size... Dimensions>
+    struct proof
+    {
+        hmpc::comp::crypto::lhe::ciphertext<Poly, Dimensions...> commitment;
+        hmpc::comp::tensor<Poly, Dimensions...> z;
+        hmpc::comp::crypto::lhe::randomness<Poly, Dimensions...> t;
+    };
+}
@@ -10,6 +10,7 @@
 #include <hmpc/expr/expression.hpp>
 #include <hmpc/index.hpp>
 #include <hmpc/ints/num/bit_copy.hpp>
+#include <hmpc/iter/for_range.hpp>
 #include <hmpc/random/number_generator.hpp>
 
 #include <unordered_map>
@@ -162,13 +163,25 @@ namespace hmpc::comp
         virtual ~tensor_lookup_value() override = default;
     };
 
-    template<typename RandomNumberGenerator = hmpc::random::number_generator<>>
+    /// # Queue
+    /// Executes expressions on a SYCL queue.
+    ///
+    /// Expressions that need random numbers get a random number generator per element with the linear element index as counter
+    /// (scaled by the `counters_per_call` of the engine, so that one engine call per element never overlaps with the next element).
+    /// With `RandomBatchSize > 1`, every work item instead computes `RandomBatchSize` consecutive elements and they share a single generator
+    /// (with the counter of element `RandomBatchSize * work_item_index`, i.e., the counters of all elements of the batch).
+    /// This avoids discarding the unused part of a block for every element and pairs well with multi-block engines (e.g., `hmpc::crypto::multi_chacha20`).
+    template<typename RandomNumberGenerator = hmpc::random::number_generator<>, hmpc::size RandomBatchSize = 1>
     struct queue
     {
+        static_assert(RandomBatchSize > 0);
+
         using queue_type = sycl::queue;
         using random_number_generator_type = RandomNumberGenerator;
         using random_number_generator_limb_type = random_number_generator_type::value_type;
 
+        static constexpr hmpc::size random_batch_size = RandomBatchSize;
+
         queue_type sycl_queue;
         std::unordered_map<tensor_lookup_key, std::unique_ptr<tensor_lookup_value_base>, tensor_lookup_key::hash, tensor_lookup_key::equal> extra_tensors;
 
@@ -195,7 +208,7 @@ namespace hmpc::comp
                 using param_type = random_number_generator_type::param_type;
                 using limb_type = random_number_generator_limb_type;
 
-                hmpc::ints::num::bit_copy(counter, hmpc::core::size_limb_span<limb_type>{index});
+                hmpc::ints::num::bit_copy(counter, hmpc::core::size_limb_span<limb_type>{index * random_number_generator_type::counters_per_call});
 
                 return param_type{key.span(hmpc::access::read), nonce.span(hmpc::access::read), counter.span(hmpc::access::read)};
             }
@@ -391,24 +404,59 @@ namespace hmpc::comp
                     auto shape = hmpc::expr::element_shape(expr);
                     auto capability_data = get_capability_data(shape);
 
-                    handler.parallel_for(sycl::range{shape.size()}, [=](hmpc::size i)
+                    if constexpr (random_batch_size > 1 and std::remove_cvref_t<decltype(capability_data)>::size > 0)
                     {
-                        auto index = [&]()
+                        auto element_count = shape.size();
+                        auto batch_count = hmpc::detail::div_ceil(element_count, random_batch_size);
+
+                        handler.parallel_for(sycl::range{batch_count}, [=](hmpc::size b)
                         {
-                            if constexpr (hmpc::expr::same_element_shape<E>)
+                            auto capabilities = make_capabilities(capability_data, b * random_batch_size, shape);
+
+                            hmpc::iter::for_range<random_batch_size>([&](auto j)
                             {
-                                return i;
-                            }
-                            else
+                                auto i = b * random_batch_size + j;
+
+                                if (i < element_count) // batches might be too big -> do nothing if out of allowed range
+                                {
+                                    auto index = [&]()
+                                    {
+                                        if constexpr (hmpc::expr::same_element_shape<E>)
+                                        {
+                                            return i;
+                                        }
+                                        else
+                                        {
+                                            return hmpc::from_linear_index(i, shape);
+                                        }
+                                    }();
+
+                                    write[index] = E::operator()(state, index, capabilities);
+                                }
+                            });
+                        });
+                    }
+                    else
+                    {
+                        handler.parallel_for(sycl::range{shape.size()}, [=](hmpc::size i)
+                        {
+                            auto index = [&]()
                             {
-                                return hmpc::from_linear_index(i, shape);
-                            }
-                        }();
-
-                        auto capabilities = make_capabilities(capability_data, index, shape);
-
-                        write[index] = E::operator()(state, index, capabilities);
-                    });
+                                if constexpr (hmpc::expr::same_element_shape<E>)
+                                {
+                                    return i;
+                                }
+                                else
+                                {
+                                    return hmpc::from_linear_index(i, shape);
+                                }
+                            }();
+
+                            auto capabilities = make_capabilities(capability_data, index, shape);
+
+                            write[index] = E::operator()(state, index, capabilities);
+                        });
+                    }
                 });
             }
         }
@@ -116,6 +116,13 @@ namespace hmpc::core
             using type = hmpc::core::uint64;
         };
 #endif
+#if defined(HMPC_HAS_UINT64) and defined(HMPC_HAS_UINT128)
+        template<>
+        struct extended_limb_type<hmpc::core::uint64>
+        {
+            using type = hmpc::core::uint128;
+        };
+#endif
 
         template<typename T>
         using extended_limb_type_t = extended_limb_type<T>::type;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <hmpc/core/add.hpp>
+#include <hmpc/core/countr_zero.hpp>
+#include <hmpc/core/has_single_bit.hpp>
 #include <hmpc/core/uint.hpp>
 
 #include <sycl/sycl.hpp>
@@ -20,6 +22,33 @@ namespace hmpc::core
         }
     };
 
+    namespace detail
+    {
+        /// Computes `value * constant` with shifts or negation for constant limbs that are all ones or powers of two.
+        template<typename Value, typename Constant>
+        constexpr auto multiply_by_constant(Value value, Constant constant) HMPC_NOEXCEPT
+        {
+            using limb_traits = hmpc::core::limb_traits<Value>;
+
+            if constexpr (std::same_as<Value, hmpc::size>)
+            {
+                return value * constant.value;
+            }
+            else if constexpr (constant.value == limb_traits::max)
+            {
+                return -value;
+            }
+            else if constexpr (hmpc::bool_cast(hmpc::core::has_single_bit(constant)))
+            {
+                return value << hmpc::core::countr_zero(constant);
+            }
+            else
+            {
+                return value * constant.value;
+            }
+        }
+    }
+
     template<typename Left, typename Right>
         requires (hmpc::same_without_constant<Left, Right>)
     constexpr auto multiply(Left left, Right right) HMPC_NOEXCEPT
@@ -43,7 +72,7 @@ namespace hmpc::core
             }
             else
             {
-                return left.value * right;
+                return detail::multiply_by_constant(right, left);
             }
         }
         else if constexpr (hmpc::is_constant<Right>)
@@ -58,7 +87,7 @@ namespace hmpc::core
             }
             else
             {
-                return left * right.value;
+                return detail::multiply_by_constant(left, right);
             }
         }
         else
@@ -67,6 +96,29 @@ namespace hmpc::core
         }
     }
 
+    namespace detail
+    {
+        /// Computes `value * max` for the largest limb value `max = 2^{bit_size} - 1` without multiplication:
+        /// value * (2^{bit_size} - 1) = (value - 1) * 2^{bit_size} + (2^{bit_size} - value) if value != 0 (and 0 otherwise)
+        template<typename Limb>
+        constexpr auto extended_multiply_max(Limb value) HMPC_NOEXCEPT
+        {
+            return multiply_result{-value, value - Limb{value != Limb{}}};
+        }
+
+        /// Computes `value * 2^Shift` without multiplication.
+        template<typename Limb, hmpc::size Shift>
+        constexpr auto extended_multiply_power_of_two(Limb value, hmpc::size_constant<Shift> shift) HMPC_NOEXCEPT
+        {
+            static_assert(shift > 0);
+            static_assert(shift < Limb::bit_size);
+            return multiply_result{value << shift, value >> hmpc::size_constant_of<Limb::bit_size - shift>};
+        }
+    }
+
+    /// Computes the full product of two limbs.
+    /// Multiplication with constant limbs that are zero, one, all ones, or powers of two is replaced by shifts and additions.
+    /// This makes Montgomery reduction for structured moduli (e.g., pseudo-Mersenne, Solinas, or NTT-friendly primes) cheaper, as their limbs are constants of this form.
     template<typename Left, typename Right>
         requires (hmpc::same_without_constant<Left, Right> and not hmpc::same_without_constant<Left, hmpc::bit>)
     constexpr auto extended_multiply(Left left, Right right) HMPC_NOEXCEPT
@@ -103,6 +155,14 @@ namespace hmpc::core
             {
                 return multiply_result{right, hmpc::zero_constant_of<limb_type>};
             }
+            else if constexpr (left.value == limb_traits::max)
+            {
+                return detail::extended_multiply_max(right);
+            }
+            else if constexpr (hmpc::bool_cast(hmpc::core::has_single_bit(left)))
+            {
+                return detail::extended_multiply_power_of_two(right, hmpc::core::countr_zero(left));
+            }
             else
             {
                 HMPC_MULTIPLY(left.value, right)
@@ -118,6 +178,14 @@ namespace hmpc::core
             {
                 return multiply_result{left, hmpc::zero_constant_of<limb_type>};
             }
+            else if constexpr (right.value == limb_traits::max)
+            {
+                return detail::extended_multiply_max(left);
+            }
+            else if constexpr (hmpc::bool_cast(hmpc::core::has_single_bit(right)))
+            {
+                return detail::extended_multiply_power_of_two(left, hmpc::core::countr_zero(right));
+            }
             else
             {
                 HMPC_MULTIPLY(left, right.value)
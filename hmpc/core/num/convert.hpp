@@ -7,24 +7,24 @@ namespace hmpc::core::num
 {
     template<hmpc::write_only_bit_span Result, hmpc::read_only_bit_span Value>
         requires (Result::bit_size == Value::bit_size)
-    void convert(Result result, Value value) HMPC_NOEXCEPT
+    constexpr void convert(Result result, Value value) HMPC_NOEXCEPT
     {
         using result_limb_type = Result::limb_type;
         if constexpr (result.limb_bit_size < value.limb_bit_size)
         {
             static_assert(value.limb_bit_size % result.limb_bit_size == 0);
             constexpr hmpc::size limb_ratio = value.limb_bit_size / result.limb_bit_size;
-            constexpr bool has_partial_limbs = result.limb_size * limb_ratio != value.limb_size;
+            constexpr bool has_partial_limbs = value.limb_size * limb_ratio != result.limb_size;
             constexpr hmpc::size full_limbs = value.limb_size - static_cast<hmpc::size>(has_partial_limbs);
             hmpc::iter::for_range<full_limbs>([&](auto i)
             {
                 auto value_limb = value.read(i);
                 result.write(hmpc::size_constant_of<i * limb_ratio>, result_limb_type{value_limb});
-                for (hmpc::size j = 1; j < limb_ratio; ++j)
+                hmpc::iter::for_range<hmpc::size{1}, limb_ratio>([&](auto j)
                 {
                     value_limb >>= hmpc::size_constant_of<result.limb_bit_size>;
                     result.write(hmpc::size_constant_of<i * limb_ratio + j>, result_limb_type{value_limb});
-                }
+                });
             });
             if constexpr (has_partial_limbs)
             {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <hmpc/core/bit_array.hpp>
 #include <hmpc/core/divide.hpp>
 #include <hmpc/core/num/add.hpp>
 #include <hmpc/core/num/bit_copy.hpp>
@@ -7,10 +8,15 @@
 #include <hmpc/core/num/compare.hpp>
 #include <hmpc/core/num/extract_bit.hpp>
 #include <hmpc/core/num/multiply.hpp>
+#include <hmpc/core/num/select.hpp>
 #include <hmpc/core/num/set_bit.hpp>
 #include <hmpc/core/num/shift_left.hpp>
 #include <hmpc/core/num/shift_right.hpp>
 #include <hmpc/core/num/subtract.hpp>
+#include <hmpc/iter/for_range.hpp>
+#include <hmpc/iter/for_reverse_range.hpp>
+
+#include <algorithm>
 
 namespace hmpc::core::num
 {
@@ -165,4 +171,59 @@ namespace hmpc::core::num
             shift_right(remainder, shifted_remainder.compiletime_span(hmpc::access::read), shift);
         }
     }
+
+    /// # Constant-time division
+    /// Division for spans with compile-time sizes that can be used at runtime (including kernels).
+    /// The consteval version above normalizes the denominator and estimates quotient limbs with a limb division,
+    /// which both depend on the value of the denominator (and limb divisions are slow or variable-time on many devices).
+    /// Instead, this uses binary long division (restoring division): For every numerator bit (from the most significant one),
+    /// the partial remainder is shifted in the next bit and the denominator is subtracted if it does not underflow.
+    /// The subtraction is always computed and the result is selected in constant time,
+    /// so the sequence of operations only depends on the sizes of the spans.
+    ///
+    /// The denominator must not be zero (checked with `HMPC_DEVICE_ASSERT`); otherwise, the quotient and remainder are unspecified.
+    template<hmpc::write_only_bit_span Quotient, hmpc::write_only_bit_span Remainder, hmpc::unsigned_read_only_bit_span Numerator, hmpc::unsigned_read_only_bit_span Denominator>
+        requires (hmpc::same_limb_types<Quotient, Remainder, Numerator, Denominator>)
+    constexpr void divide(Quotient quotient, Remainder remainder, Numerator numerator, Denominator denominator) HMPC_NOEXCEPT
+    {
+        using limb_type = Quotient::limb_type;
+        using limb_traits = hmpc::core::limb_traits<limb_type>;
+        constexpr auto top_shift = hmpc::size_constant_of<limb_traits::bit_size - 1>;
+
+        HMPC_DEVICE_ASSERT(bit_width(denominator) != 0);
+
+        // partial remainder < denominator, with one more bit for the shifted in numerator bit
+        hmpc::core::bit_array<denominator.bit_size + 1, limb_type, hmpc::without_sign> partial_remainder = {};
+        hmpc::core::bit_array<denominator.bit_size + 1, limb_type, hmpc::without_sign> difference;
+        auto read_partial_remainder = partial_remainder.span(hmpc::access::read);
+        auto write_partial_remainder = partial_remainder.span(hmpc::access::write);
+
+        hmpc::iter::for_reverse_range<numerator.limb_size>([&](auto i)
+        {
+            auto numerator_limb = numerator.extended_read(i, hmpc::access::normal);
+            auto quotient_limb = limb_traits::zero.value;
+            for (hmpc::size j = 0; j < limb_traits::bit_size; ++j)
+            {
+                // partial_remainder = 2 * partial_remainder + next numerator bit
+                shift_left(write_partial_remainder, read_partial_remainder, hmpc::constants::one);
+                write_partial_remainder.write(hmpc::constants::zero, read_partial_remainder.read(hmpc::constants::zero) | (numerator_limb >> top_shift));
+                numerator_limb <<= hmpc::constants::one;
+
+                auto borrow = subtract(difference.span(hmpc::access::write), read_partial_remainder, denominator);
+                select(write_partial_remainder, difference.span(hmpc::access::read), read_partial_remainder, borrow);
+
+                quotient_limb = (quotient_limb << hmpc::constants::one) | limb_type{not borrow};
+            }
+            if constexpr (i < quotient.limb_size)
+            {
+                quotient.write(i, quotient_limb);
+            }
+        });
+        hmpc::iter::for_range<numerator.limb_size, std::max(numerator.limb_size, quotient.limb_size)>([&](auto i)
+        {
+            quotient.write(i, hmpc::zero_constant_of<limb_type>);
+        });
+
+        bit_copy(remainder, read_partial_remainder);
+    }
 }
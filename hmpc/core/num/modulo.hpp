@@ -4,6 +4,7 @@
 #include <hmpc/core/masked_bit_span.hpp>
 #include <hmpc/core/multiply.hpp>
 #include <hmpc/core/num/compare.hpp>
+#include <hmpc/core/subtract.hpp>
 #include <hmpc/iter/next.hpp>
 
 namespace hmpc::core::num
@@ -64,4 +65,95 @@ namespace hmpc::core::num
 
         subtract(result, S, modulus.mask(greater_equal(S, modulus)));
     }
+
+    namespace detail
+    {
+        /// Limb `Index` of a two-limb value `value` that starts at limb `Position` (zero outside of it).
+        template<hmpc::size Index, hmpc::size Position, typename LowerLimb, typename UpperLimb>
+        constexpr auto limb_of(hmpc::size_constant<Index>, hmpc::size_constant<Position>, hmpc::core::multiply_result<LowerLimb, UpperLimb> value) HMPC_NOEXCEPT
+        {
+            if constexpr (Index == Position)
+            {
+                return value.lower;
+            }
+            else if constexpr (Index == Position + 1)
+            {
+                return value.upper;
+            }
+            else
+            {
+                return hmpc::zero_constant_of<hmpc::traits::remove_constant_t<LowerLimb>>;
+            }
+        }
+    }
+
+    /// Montgomery reduction for pseudo-Mersenne moduli N = 2^k - c.
+    /// This is the same algorithm as `montgomery_reduce`, but adds m * N = m * 2^k - m * c in every step,
+    /// i.e., it needs a single limb product with c (instead of one product per limb of N) and a shifted addition of m.
+    ///
+    /// #### Preconditions
+    /// Let k = shift
+    /// Let c = offset
+    /// Require N == pow(2, k) - c
+    /// Require 0 < c < B
+    /// and all preconditions of `montgomery_reduce`
+    ///
+    /// #### Postcondition
+    /// Same as `montgomery_reduce`
+    template<hmpc::unsigned_write_only_bit_span Result, hmpc::unsigned_read_only_bit_span Value, hmpc::unsigned_read_only_bit_span Modulus, hmpc::size AuxiliaryPower, hmpc::is_constant_of<typename Result::limb_type> InverseModulus, hmpc::size Shift, hmpc::is_constant_of<typename Result::limb_type> Offset>
+        requires (hmpc::same_limb_types<Result, Value, Modulus>)
+    constexpr void pseudo_mersenne_reduce(Result result, Value value, Modulus modulus, hmpc::size_constant<AuxiliaryPower> auxiliary_power, InverseModulus inverse_modulus, hmpc::size_constant<Shift>, Offset offset) HMPC_NOEXCEPT
+    {
+        using limb_type = Result::limb_type;
+        using limb_traits = hmpc::core::limb_traits<limb_type>;
+        constexpr auto r = AuxiliaryPower;
+        constexpr auto p = modulus.limb_size;
+        constexpr auto shift_limbs = Shift / limb_traits::bit_size;
+        constexpr auto shift_bits = Shift % limb_traits::bit_size;
+        static_assert(shift_limbs <= p);
+        HMPC_DEVICE_ASSERT(hmpc::core::limb_size_for<limb_type>(bit_width(modulus)) == modulus.limb_size);
+
+        hmpc::core::bit_array<limb_traits::bit_size * (r + p + 1), limb_type, hmpc::without_sign> T_storage = {};
+        auto T = T_storage.span(hmpc::access::read_write);
+
+        bit_copy(T_storage.span(hmpc::access::write), value);
+
+        hmpc::iter::for_range<r>([&](auto i)
+        {
+            auto m = hmpc::core::multiply(T.read(i), inverse_modulus);
+
+            // T += m * 2^k * B^i
+            auto shifted = [&]()
+            {
+                if constexpr (shift_bits == 0)
+                {
+                    return hmpc::core::multiply_result{m, hmpc::zero_constant_of<limb_type>};
+                }
+                else
+                {
+                    return hmpc::core::detail::extended_multiply_power_of_two(m, hmpc::size_constant_of<shift_bits>);
+                }
+            }();
+            constexpr auto shifted_position = hmpc::size_constant_of<i + shift_limbs>;
+            hmpc::iter::scan_range<shifted_position.value, T.limb_size>([&](auto j, auto carry)
+            {
+                auto [sum, new_carry] = hmpc::core::extended_add(T.read(j), detail::limb_of(j, shifted_position, shifted), carry);
+                T.write(j, sum);
+                return new_carry;
+            }, hmpc::constants::bit::zero);
+
+            // T -= m * c * B^i (does not underflow as T + m * N >= 0)
+            auto product = hmpc::core::extended_multiply(m, offset);
+            hmpc::iter::scan_range<i, T.limb_size>([&](auto j, auto borrow)
+            {
+                auto [difference, new_borrow] = hmpc::core::subtract(T.read(j), detail::limb_of(j, i, product), borrow);
+                T.write(j, difference);
+                return new_borrow;
+            }, hmpc::constants::bit::zero);
+        });
+
+        auto S = T_storage.span(hmpc::access::read).subspan(auxiliary_power);
+
+        subtract(result, S, modulus.mask(greater_equal(S, modulus)));
+    }
 }
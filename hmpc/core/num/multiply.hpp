@@ -6,17 +6,41 @@
 #include <hmpc/core/compiletime_bit_array.hpp>
 #include <hmpc/core/compiletime_bit_span.hpp>
 #include <hmpc/core/multiply.hpp>
+#include <hmpc/core/num/add.hpp>
+#include <hmpc/core/num/subtract.hpp>
 #include <hmpc/iter/for_range.hpp>
 #include <hmpc/iter/next.hpp>
 #include <hmpc/iter/scan_range.hpp>
 
 #include <algorithm>
 
+#ifndef HMPC_KARATSUBA_THRESHOLD
+    #define HMPC_KARATSUBA_THRESHOLD 16
+#endif
+
 namespace hmpc::core::num
 {
+    /// Minimum number of limbs of both factors such that `multiply` uses `karatsuba_multiply` instead of `schoolbook_multiply`.
+    /// Can be tuned by defining `HMPC_KARATSUBA_THRESHOLD`.
+    constexpr hmpc::size karatsuba_threshold = HMPC_KARATSUBA_THRESHOLD;
+
+    namespace detail
+    {
+        template<typename Span>
+        concept splittable_bit_span = requires(Span span)
+        {
+            span.first_limbs(hmpc::constants::one);
+            span.subspan(hmpc::constants::one);
+        };
+    }
+
     template<hmpc::unsigned_write_only_bit_span Result, hmpc::unsigned_read_only_bit_span Left, hmpc::unsigned_read_only_bit_span Right>
         requires (hmpc::same_limb_types<Result, Left, Right>)
-    constexpr void multiply(Result result, Left left, Right right) HMPC_NOEXCEPT
+    constexpr void multiply(Result result, Left left, Right right) HMPC_NOEXCEPT;
+
+    template<hmpc::unsigned_write_only_bit_span Result, hmpc::unsigned_read_only_bit_span Left, hmpc::unsigned_read_only_bit_span Right>
+        requires (hmpc::same_limb_types<Result, Left, Right>)
+    constexpr void schoolbook_multiply(Result result, Left left, Right right) HMPC_NOEXCEPT
     {
         using limb_type = Result::limb_type;
         hmpc::core::bit_array<std::min(result.bit_size, left.bit_size + right.bit_size), limb_type, result.signedness> intermediate_storage;
@@ -100,6 +124,101 @@ namespace hmpc::core::num
         });
     }
 
+    /// # Karatsuba multiplication
+    /// Splits both factors at `split` limbs and computes the product with three instead of four half-sized products.
+    /// The half-sized products are computed with `multiply` again, i.e., recursively with Karatsuba multiplication as long as they are above `karatsuba_threshold`.
+    ///
+    /// #### Algorithm reference
+    /// Knuth, The Art of Computer Programming, Vol. 2, Section 4.3.3.A
+    ///
+    /// ### Preconditions
+    /// - `result` can hold the full product: `result.bit_size >= left.bit_size + right.bit_size`
+    /// - Both factors have more than `split` limbs
+    template<hmpc::unsigned_write_only_bit_span Result, hmpc::unsigned_read_only_bit_span Left, hmpc::unsigned_read_only_bit_span Right>
+        requires (hmpc::same_limb_types<Result, Left, Right> and detail::splittable_bit_span<Left> and detail::splittable_bit_span<Right>)
+    constexpr void karatsuba_multiply(Result result, Left left, Right right) HMPC_NOEXCEPT
+    {
+        using limb_type = Result::limb_type;
+        constexpr hmpc::size limb_bit_size = limb_type::bit_size;
+
+        constexpr auto split = hmpc::size_constant_of<(std::max(left.limb_size, right.limb_size) + 1) / 2>;
+        constexpr auto double_split = hmpc::size_constant_of<2 * split>;
+        static_assert(left.limb_size > split);
+        static_assert(right.limb_size > split);
+        static_assert(result.bit_size >= left.bit_size + right.bit_size);
+
+        // left = left_1 * 2^{split * limb_bit_size} + left_0
+        // right = right_1 * 2^{split * limb_bit_size} + right_0
+        // left * right = z_2 * 2^{2 * split * limb_bit_size} + z_1 * 2^{split * limb_bit_size} + z_0
+        // with
+        // z_0 = left_0 * right_0
+        // z_2 = left_1 * right_1
+        // z_1 = left_0 * right_1 + left_1 * right_0 = (left_0 + left_1) * (right_0 + right_1) - z_0 - z_2
+        auto left_0 = left.first_limbs(split);
+        auto left_1 = left.subspan(split);
+        auto right_0 = right.first_limbs(split);
+        auto right_1 = right.subspan(split);
+
+        hmpc::core::bit_array<left.bit_size + right.bit_size, limb_type, hmpc::without_sign> product_storage;
+        auto product = product_storage.span(hmpc::access::read_write);
+
+        // z_0 and z_2 do not overlap
+        multiply(product.first_limbs(double_split).span(hmpc::access::write), left_0, right_0);
+        multiply(product.subspan(double_split).span(hmpc::access::write), left_1, right_1);
+
+        // left_1 and right_1 have at most split limbs, so the sums fit into split limbs and one carry bit
+        hmpc::core::bit_array<split * limb_bit_size + 1, limb_type, hmpc::without_sign> left_sum;
+        hmpc::core::bit_array<split * limb_bit_size + 1, limb_type, hmpc::without_sign> right_sum;
+        hmpc::core::num::add(left_sum.span(hmpc::access::write), left_0, left_1);
+        hmpc::core::num::add(right_sum.span(hmpc::access::write), right_0, right_1);
+
+        hmpc::core::bit_array<left_sum.bit_size + right_sum.bit_size, limb_type, hmpc::without_sign> middle_storage;
+        auto middle = middle_storage.span(hmpc::access::read_write);
+        multiply(middle.span(hmpc::access::write), left_sum.span(hmpc::access::read), right_sum.span(hmpc::access::read));
+        // no underflow, as z_1 >= 0
+        hmpc::core::num::subtract(middle.span(hmpc::access::write), middle.span(hmpc::access::read), product.first_limbs(double_split).span(hmpc::access::read));
+        hmpc::core::num::subtract(middle.span(hmpc::access::write), middle.span(hmpc::access::read), product.subspan(double_split).span(hmpc::access::read));
+
+        // no overflow, as the full product fits into product
+        auto upper_product = product.subspan(split);
+        hmpc::core::num::add(upper_product.span(hmpc::access::write), upper_product.span(hmpc::access::read), middle.span(hmpc::access::read));
+
+        hmpc::iter::for_range<product.limb_size>([&](auto i)
+        {
+            result.write(i, product.read(i));
+        });
+        hmpc::iter::for_range<product.limb_size, result.limb_size>([&](auto i)
+        {
+            result.write(i, {}, hmpc::access::unnormal);
+        });
+    }
+
+    /// Multiplies `left` and `right`.
+    /// Uses `karatsuba_multiply` if both factors are (roughly balanced and) at least `karatsuba_threshold` limbs long and the full product is computed.
+    /// Otherwise, uses `schoolbook_multiply`.
+    template<hmpc::unsigned_write_only_bit_span Result, hmpc::unsigned_read_only_bit_span Left, hmpc::unsigned_read_only_bit_span Right>
+        requires (hmpc::same_limb_types<Result, Left, Right>)
+    constexpr void multiply(Result result, Left left, Right right) HMPC_NOEXCEPT
+    {
+        constexpr hmpc::size min_limb_size = std::min(left.limb_size, right.limb_size);
+        constexpr hmpc::size split = (std::max(left.limb_size, right.limb_size) + 1) / 2;
+
+        if constexpr (
+            min_limb_size >= karatsuba_threshold
+            and min_limb_size > split
+            and result.bit_size >= left.bit_size + right.bit_size
+            and detail::splittable_bit_span<Left>
+            and detail::splittable_bit_span<Right>
+        )
+        {
+            karatsuba_multiply(result, left, right);
+        }
+        else
+        {
+            schoolbook_multiply(result, left, right);
+        }
+    }
+
     template<hmpc::write_only_compiletime_bit_span Result, hmpc::read_only_compiletime_bit_span Left, hmpc::read_only_compiletime_bit_span Right>
         requires (hmpc::same_limb_types<Result, Left, Right>)
     consteval void multiply(Result result, Left left, Right right)
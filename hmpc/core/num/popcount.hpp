@@ -0,0 +1,20 @@
+#pragma once
+
+#include <hmpc/core/bit_span.hpp>
+#include <hmpc/core/popcount.hpp>
+#include <hmpc/iter/for_range.hpp>
+
+namespace hmpc::core::num
+{
+    /// Number of set bits of `value` (one `popcount` per limb)
+    template<hmpc::unsigned_read_only_bit_span Value>
+    constexpr hmpc::size popcount(Value value) HMPC_NOEXCEPT
+    {
+        hmpc::size count = 0;
+        hmpc::iter::for_range<value.limb_size>([&](auto i)
+        {
+            count += hmpc::core::popcount(value.extended_read(i, hmpc::access::normal));
+        });
+        return count;
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <hmpc/core/add.hpp>
+#include <hmpc/core/bit_array.hpp>
+#include <hmpc/core/bit_span.hpp>
+#include <hmpc/core/multiply.hpp>
+#include <hmpc/core/num/multiply.hpp>
+#include <hmpc/core/num/shift_left.hpp>
+#include <hmpc/iter/for_range.hpp>
+#include <hmpc/iter/next.hpp>
+#include <hmpc/iter/scan_range.hpp>
+
+#include <algorithm>
+
+namespace hmpc::core::num
+{
+    /// # Schoolbook squaring
+    /// For value = a_{n-1} ... a_1 a_0, the square is
+    ///     value^2 = 2 * \sum_{i < j} a_i * a_j * 2^{(i + j) * limb_bit_size} + \sum_{i} a_i^2 * 2^{2 * i * limb_bit_size}.
+    /// We compute every off-diagonal product a_i * a_j once, double the sum with a shift, and add the diagonal,
+    /// i.e., n * (n + 1) / 2 instead of n^2 limb products.
+    template<hmpc::unsigned_write_only_bit_span Result, hmpc::unsigned_read_only_bit_span Value>
+        requires (hmpc::same_limb_types<Result, Value>)
+    constexpr void schoolbook_square(Result result, Value value) HMPC_NOEXCEPT
+    {
+        using limb_type = Result::limb_type;
+        constexpr hmpc::size limb_size = value.limb_size;
+
+        hmpc::core::bit_array<2 * limb_size * value.limb_bit_size, limb_type, hmpc::without_sign> intermediate_storage = {};
+        auto intermediate = intermediate_storage.span(hmpc::access::read_write);
+
+        // off-diagonal products; row i writes limbs [2 * i + 1, i + limb_size], previous rows only wrote up to i - 1 + limb_size
+        hmpc::iter::for_range<limb_size>([&](auto i)
+        {
+            if constexpr (i + 1 < limb_size)
+            {
+                auto carry = hmpc::iter::scan_range<limb_size - i - 1>([&](auto offset, auto carry)
+                {
+                    constexpr auto j = hmpc::iter::next(i, hmpc::iter::next(offset));
+                    constexpr auto k = hmpc::iter::next(i, j);
+
+                    auto [lower, upper] = hmpc::core::extended_multiply_add(value.read(i), value.read(j), intermediate.read(k), carry);
+                    intermediate.write(k, lower);
+                    return upper;
+                }, hmpc::zero_constant_of<limb_type>);
+                intermediate.write(hmpc::iter::next(i, hmpc::size_constant_of<limb_size>), carry);
+            }
+        });
+
+        // the off-diagonal sum is less than half of the square, so doubling cannot overflow
+        shift_left(intermediate.span(hmpc::access::write), intermediate.span(hmpc::access::read), hmpc::constants::one);
+
+        hmpc::iter::scan_range<limb_size>([&](auto i, auto carry)
+        {
+            constexpr auto lower_index = hmpc::iter::next(i, i);
+            constexpr auto upper_index = hmpc::iter::next(lower_index);
+
+            auto [lower, upper] = hmpc::core::extended_multiply(value.read(i), value.read(i));
+            auto [lower_sum, lower_carry] = hmpc::core::extended_add(intermediate.read(lower_index), lower, carry);
+            auto [upper_sum, upper_carry] = hmpc::core::extended_add(intermediate.read(upper_index), upper, lower_carry);
+            intermediate.write(lower_index, lower_sum);
+            intermediate.write(upper_index, upper_sum);
+            return upper_carry;
+        }, hmpc::constants::bit::zero);
+
+        constexpr hmpc::size overlap = std::min(result.limb_size, intermediate.limb_size);
+        hmpc::iter::for_range<overlap>([&](auto i)
+        {
+            result.write(i, intermediate.read(i));
+        });
+        hmpc::iter::for_range<overlap, result.limb_size>([&](auto i)
+        {
+            result.write(i, {}, hmpc::access::unnormal);
+        });
+    }
+
+    /// Squares `value`.
+    /// Uses `multiply` (and thus Karatsuba multiplication) for values with at least `karatsuba_threshold` limbs.
+    /// Otherwise, uses `schoolbook_square`.
+    template<hmpc::unsigned_write_only_bit_span Result, hmpc::unsigned_read_only_bit_span Value>
+        requires (hmpc::same_limb_types<Result, Value>)
+    constexpr void square(Result result, Value value) HMPC_NOEXCEPT
+    {
+        if constexpr (value.limb_size >= karatsuba_threshold)
+        {
+            multiply(result, value, value);
+        }
+        else
+        {
+            schoolbook_square(result, value);
+        }
+    }
+}
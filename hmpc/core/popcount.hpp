@@ -0,0 +1,21 @@
+#pragma once
+
+#include <hmpc/constant.hpp>
+
+#include <bit>
+
+namespace hmpc::core
+{
+    template<typename Value>
+    constexpr auto popcount(Value value) HMPC_NOEXCEPT
+    {
+        if constexpr (hmpc::is_constant<Value>)
+        {
+            return hmpc::size_constant_of<std::popcount(value.value.data)>;
+        }
+        else
+        {
+            return static_cast<hmpc::size>(std::popcount(value.data));
+        }
+    }
+}
@@ -358,6 +358,15 @@ namespace hmpc::core
     #define HMPC_HAS_UINT64
     using uint64 = uint<std::uint64_t>;
 #endif
+#ifdef __SIZEOF_INT128__
+    #define HMPC_HAS_UINT128
+    namespace detail
+    {
+        /// Not a standard integer type; `std::numeric_limits` is only specialized when compiling with GNU extensions (the default for CMake).
+        __extension__ typedef unsigned __int128 uint128_t;
+    }
+    using uint128 = uint<detail::uint128_t>;
+#endif
 }
 
 namespace hmpc
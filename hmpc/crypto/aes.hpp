@@ -0,0 +1,442 @@
+#pragma once
+
+#include <hmpc/core/limb_array.hpp>
+#include <hmpc/core/size_limb_span.hpp>
+#include <hmpc/core/uint.hpp>
+#include <hmpc/ints/num/add.hpp>
+#include <hmpc/iter/for_packed_range.hpp>
+#include <hmpc/iter/for_range.hpp>
+
+#include <array>
+#include <cstdint>
+
+#if defined(__AES__) and defined(__SSE2__) and not defined(__SYCL_DEVICE_ONLY__)
+    #define HMPC_HAS_AES_NI
+    #include <wmmintrin.h>
+#endif
+
+namespace hmpc::crypto::detail
+{
+    /// Bit planes of (up to) 64 bytes: bit j of byte b is bit b of plane j
+    using aes_planes = std::array<std::uint64_t, 8>;
+
+    /// Multiplication in GF(2^8) = GF(2)[x] / (x^8 + x^4 + x^3 + x + 1) for all bytes of the bit planes
+    constexpr aes_planes aes_multiply(aes_planes const& left, aes_planes const& right) HMPC_NOEXCEPT
+    {
+        std::array<std::uint64_t, 15> product = {};
+        hmpc::iter::for_range<hmpc::size{8}>([&](auto i)
+        {
+            hmpc::iter::for_range<hmpc::size{8}>([&](auto j)
+            {
+                product[i + j] ^= left[i] & right[j];
+            });
+        });
+
+        // x^k == x^{k-8} * (x^4 + x^3 + x + 1)
+        hmpc::iter::for_range<hmpc::size{7}>([&](auto i)
+        {
+            constexpr hmpc::size k = 14 - i;
+            product[k - 4] ^= product[k];
+            product[k - 5] ^= product[k];
+            product[k - 7] ^= product[k];
+            product[k - 8] ^= product[k];
+        });
+
+        aes_planes result;
+        hmpc::iter::for_range<hmpc::size{8}>([&](auto i)
+        {
+            result[i] = product[i];
+        });
+        return result;
+    }
+
+    /// # Bitsliced AES S-box
+    /// Transposes the bytes to bit planes and computes the S-box for all of them at once (without table lookups, i.e., in constant time):
+    /// 1. Invert in GF(2^8) via x^254 (which maps 0 to 0) with the addition chain x^2, x^3, x^6, x^12, x^15, x^240, x^252, x^254.
+    /// 2. Apply the affine transformation s_i = b_i ^ b_{i+4} ^ b_{i+5} ^ b_{i+6} ^ b_{i+7} ^ c_i with c = 0x63 (indices mod 8).
+    template<hmpc::size N>
+    constexpr void aes_sub_bytes(std::array<std::uint8_t, N>& bytes) HMPC_NOEXCEPT
+    {
+        static_assert(N <= 64);
+
+        aes_planes x = {};
+        for (hmpc::size b = 0; b < N; ++b)
+        {
+            hmpc::iter::for_range<hmpc::size{8}>([&](auto j)
+            {
+                x[j] |= static_cast<std::uint64_t>((bytes[b] >> j) & 1) << b;
+            });
+        }
+
+        auto x2 = aes_multiply(x, x);
+        auto x3 = aes_multiply(x2, x);
+        auto x6 = aes_multiply(x3, x3);
+        auto x12 = aes_multiply(x6, x6);
+        auto x240 = aes_multiply(x12, x3);
+        hmpc::iter::for_range<hmpc::size{4}>([&](auto)
+        {
+            x240 = aes_multiply(x240, x240);
+        });
+        auto inverse = aes_multiply(aes_multiply(x240, x12), x2);
+
+        aes_planes s;
+        hmpc::iter::for_range<hmpc::size{8}>([&](auto i)
+        {
+            s[i] = inverse[i] ^ inverse[(i + 4) % 8] ^ inverse[(i + 5) % 8] ^ inverse[(i + 6) % 8] ^ inverse[(i + 7) % 8];
+            if constexpr (((0x63 >> i) & 1) != 0)
+            {
+                s[i] = ~s[i];
+            }
+        });
+
+        for (hmpc::size b = 0; b < N; ++b)
+        {
+            std::uint8_t value = 0;
+            hmpc::iter::for_range<hmpc::size{8}>([&](auto j)
+            {
+                value |= static_cast<std::uint8_t>(((s[j] >> b) & 1) << j);
+            });
+            bytes[b] = value;
+        }
+    }
+
+    /// Multiplication with x in GF(2^8) (in constant time)
+    constexpr std::uint8_t aes_xtime(std::uint8_t value) HMPC_NOEXCEPT
+    {
+        return static_cast<std::uint8_t>((value << 1) ^ (0x1b & -(value >> 7)));
+    }
+
+    /// Round keys as little-endian 32-bit words (i.e., in the byte order of FIPS 197)
+    template<hmpc::size Rounds>
+    using aes_round_keys = std::array<std::uint32_t, 4 * (Rounds + 1)>;
+
+    template<hmpc::size Blocks>
+    using aes_blocks = std::array<std::array<std::uint32_t, 4>, Blocks>;
+
+    /// Key expansion (FIPS 197, section 5.2) for keys with `KeySize` 32-bit words
+    template<hmpc::size KeySize>
+    constexpr auto aes_expand_key(std::array<std::uint32_t, KeySize> const& key) HMPC_NOEXCEPT
+    {
+        constexpr hmpc::size rounds = KeySize + 6;
+
+        aes_round_keys<rounds> round_keys;
+        std::uint8_t round_constant = 1;
+        for (hmpc::size i = 0; i < round_keys.size(); ++i)
+        {
+            if (i < KeySize)
+            {
+                round_keys[i] = key[i];
+                continue;
+            }
+
+            auto word = round_keys[i - 1];
+            if (i % KeySize == 0 or (KeySize > 6 and i % KeySize == 4))
+            {
+                if (i % KeySize == 0)
+                {
+                    word = (word >> 8) | (word << 24); // RotWord for little-endian words
+                }
+                std::array<std::uint8_t, 4> bytes = {static_cast<std::uint8_t>(word), static_cast<std::uint8_t>(word >> 8), static_cast<std::uint8_t>(word >> 16), static_cast<std::uint8_t>(word >> 24)};
+                aes_sub_bytes(bytes);
+                word = bytes[0] | (std::uint32_t{bytes[1]} << 8) | (std::uint32_t{bytes[2]} << 16) | (std::uint32_t{bytes[3]} << 24);
+                if (i % KeySize == 0)
+                {
+                    word ^= round_constant;
+                    round_constant = aes_xtime(round_constant);
+                }
+            }
+            round_keys[i] = round_keys[i - KeySize] ^ word;
+        }
+        return round_keys;
+    }
+
+    /// Encrypts all blocks in software (bitsliced SubBytes over all blocks, constant time); usable at compile time and on devices
+    template<hmpc::size Rounds, hmpc::size Blocks>
+    constexpr void aes_encrypt_software(aes_round_keys<Rounds> const& round_keys, aes_blocks<Blocks>& blocks) HMPC_NOEXCEPT
+    {
+        static_assert(Blocks <= 4);
+
+        std::array<std::uint8_t, 16 * Blocks> state;
+        auto add_round_key = [&](hmpc::size round)
+        {
+            hmpc::iter::for_range<Blocks>([&](auto l)
+            {
+                hmpc::iter::for_range<hmpc::size{16}>([&](auto i)
+                {
+                    state[16 * l + i] ^= static_cast<std::uint8_t>(round_keys[4 * round + i / 4] >> (8 * (i % 4)));
+                });
+            });
+        };
+
+        hmpc::iter::for_range<Blocks>([&](auto l)
+        {
+            hmpc::iter::for_range<hmpc::size{16}>([&](auto i)
+            {
+                state[16 * l + i] = static_cast<std::uint8_t>(blocks[l][i / 4] >> (8 * (i % 4)));
+            });
+        });
+        add_round_key(0);
+
+        for (hmpc::size round = 1; round <= Rounds; ++round)
+        {
+            aes_sub_bytes(state);
+
+            hmpc::iter::for_range<Blocks>([&](auto l)
+            {
+                // ShiftRows: byte 4 * c + r is row r of column c
+                std::array<std::uint8_t, 16> shifted;
+                hmpc::iter::for_range<hmpc::size{4}>([&](auto c)
+                {
+                    hmpc::iter::for_range<hmpc::size{4}>([&](auto r)
+                    {
+                        shifted[4 * c + r] = state[16 * l + 4 * ((c + r) % 4) + r];
+                    });
+                });
+
+                // MixColumns (skipped in the last round)
+                if (round != Rounds)
+                {
+                    hmpc::iter::for_range<hmpc::size{4}>([&](auto c)
+                    {
+                        auto a0 = shifted[4 * c];
+                        auto a1 = shifted[4 * c + 1];
+                        auto a2 = shifted[4 * c + 2];
+                        auto a3 = shifted[4 * c + 3];
+                        auto sum = static_cast<std::uint8_t>(a0 ^ a1 ^ a2 ^ a3);
+                        shifted[4 * c] = a0 ^ sum ^ aes_xtime(a0 ^ a1);
+                        shifted[4 * c + 1] = a1 ^ sum ^ aes_xtime(a1 ^ a2);
+                        shifted[4 * c + 2] = a2 ^ sum ^ aes_xtime(a2 ^ a3);
+                        shifted[4 * c + 3] = a3 ^ sum ^ aes_xtime(a3 ^ a0);
+                    });
+                }
+
+                hmpc::iter::for_range<hmpc::size{16}>([&](auto i)
+                {
+                    state[16 * l + i] = shifted[i];
+                });
+            });
+
+            add_round_key(round);
+        }
+
+        hmpc::iter::for_range<Blocks>([&](auto l)
+        {
+            hmpc::iter::for_range<hmpc::size{4}>([&](auto w)
+            {
+                blocks[l][w] = state[16 * l + 4 * w]
+                    | (std::uint32_t{state[16 * l + 4 * w + 1]} << 8)
+                    | (std::uint32_t{state[16 * l + 4 * w + 2]} << 16)
+                    | (std::uint32_t{state[16 * l + 4 * w + 3]} << 24);
+            });
+        });
+    }
+
+#ifdef HMPC_HAS_AES_NI
+    /// Encrypts all blocks with AES-NI; every round is applied to all blocks before the next one to hide the instruction latency
+    template<hmpc::size Rounds, hmpc::size Blocks>
+    inline void aes_encrypt_hardware(aes_round_keys<Rounds> const& round_keys, aes_blocks<Blocks>& blocks) HMPC_NOEXCEPT
+    {
+        auto round_key = [&](hmpc::size round)
+        {
+            return _mm_loadu_si128(reinterpret_cast<__m128i const*>(round_keys.data() + 4 * round));
+        };
+
+        __m128i state[Blocks];
+        hmpc::iter::for_range<Blocks>([&](auto l)
+        {
+            state[l] = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(blocks[l].data())), round_key(0));
+        });
+        for (hmpc::size round = 1; round < Rounds; ++round)
+        {
+            auto key = round_key(round);
+            hmpc::iter::for_range<Blocks>([&](auto l)
+            {
+                state[l] = _mm_aesenc_si128(state[l], key);
+            });
+        }
+        auto key = round_key(Rounds);
+        hmpc::iter::for_range<Blocks>([&](auto l)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(blocks[l].data()), _mm_aesenclast_si128(state[l], key));
+        });
+    }
+#endif
+
+    /// Uses AES-NI at runtime (if available on the host target) and `aes_encrypt_software` otherwise
+    template<hmpc::size Rounds, hmpc::size Blocks>
+    constexpr void aes_encrypt(aes_round_keys<Rounds> const& round_keys, aes_blocks<Blocks>& blocks) HMPC_NOEXCEPT
+    {
+#ifdef HMPC_HAS_AES_NI
+        if !consteval
+        {
+            aes_encrypt_hardware<Rounds>(round_keys, blocks);
+            return;
+        }
+#endif
+        aes_encrypt_software<Rounds>(round_keys, blocks);
+    }
+}
+
+namespace hmpc::crypto
+{
+    template<hmpc::size KeySize, hmpc::size NonceSize, hmpc::size CounterSize>
+    struct aes_param
+    {
+        static_assert(KeySize == 4 or KeySize == 6 or KeySize == 8);
+        static_assert(CounterSize > 0);
+        static_assert(NonceSize > 0);
+        static_assert(CounterSize + NonceSize == 4);
+
+        static constexpr hmpc::size key_size = KeySize;
+        static constexpr hmpc::size counter_size = CounterSize;
+        static constexpr hmpc::size nonce_size = NonceSize;
+
+        using value_type = hmpc::core::uint32;
+
+        hmpc::core::limb_span<key_size, value_type, hmpc::access::read_tag> key;
+        hmpc::core::limb_span<nonce_size, value_type, hmpc::access::read_tag> nonce;
+        hmpc::core::limb_span<counter_size, value_type, hmpc::access::read_tag> counter;
+    };
+
+    /// # AES in counter mode
+    /// Encrypts the counter blocks (counter || nonce, as little-endian 32-bit words) with AES-128, AES-192, or AES-256
+    /// (`KeySize` of 4, 6, or 8 words) and returns `Blocks` blocks of keystream per call.
+    /// Every call consumes `Blocks` counter values (see `counters_per_call`), like `hmpc::crypto::multi_chacha`.
+    ///
+    /// On the host, this uses AES-NI if the target supports it (e.g., `-maes` or `-march=native`).
+    /// Otherwise (and on devices and at compile time), it uses a constant-time software implementation with a bitsliced S-box.
+    /// Both give the same keystream.
+    template<hmpc::size KeySize, hmpc::size NonceSize, hmpc::size CounterSize, hmpc::size Blocks = 4>
+    struct aes_ctr
+    {
+        static_assert(Blocks > 0 and Blocks <= 4);
+
+        static constexpr hmpc::size key_size = KeySize;
+        static constexpr hmpc::size counter_size = CounterSize;
+        static constexpr hmpc::size nonce_size = NonceSize;
+        static constexpr hmpc::size rounds = key_size + 6;
+        static constexpr hmpc::size blocks = Blocks;
+        static constexpr hmpc::size block_size = 4 * blocks;
+        static constexpr hmpc::size counters_per_call = blocks;
+
+        using param_type = aes_param<key_size, nonce_size, counter_size>;
+        using value_type = hmpc::core::uint32;
+        using block_type = hmpc::core::limb_array<block_size, value_type>;
+
+        /// Key, counter, and nonce (same order as for `chacha`)
+        hmpc::core::limb_array<key_size + counter_size + nonce_size, value_type> state;
+        hmpc::crypto::detail::aes_round_keys<rounds> round_keys;
+
+    private:
+        constexpr void expand_key() HMPC_NOEXCEPT
+        {
+            std::array<std::uint32_t, key_size> key;
+            hmpc::iter::for_range<key_size>([&](auto i)
+            {
+                key[i] = state[i].data;
+            });
+            round_keys = hmpc::crypto::detail::aes_expand_key(key);
+        }
+
+    public:
+        consteval aes_ctr(hmpc::compiletime_tag)
+            : state{}
+            , round_keys{}
+        {
+            expand_key();
+        }
+
+        constexpr aes_ctr(param_type param) HMPC_NOEXCEPT
+            : state
+            {
+                hmpc::iter::for_packed_range<key_size>([&](auto... i)
+                {
+                    return hmpc::iter::for_packed_range<counter_size>([&](auto... j)
+                    {
+                        return hmpc::iter::for_packed_range<nonce_size>([&](auto... k)
+                        {
+                            return decltype(state)
+                            {
+                                param.key[i]...,
+                                param.counter[j]...,
+                                param.nonce[k]...
+                            };
+                        });
+                    });
+                })
+            }
+            , round_keys{}
+        {
+            expand_key();
+        }
+
+        constexpr param_type param() const noexcept
+        {
+            auto span = state.span(hmpc::access::read);
+            return param_type{
+                span.subspan<0, key_size>(),
+                span.subspan<key_size + counter_size, nonce_size>(),
+                span.subspan<key_size, counter_size>()
+            };
+        }
+
+        constexpr void param(param_type param) HMPC_NOEXCEPT
+        {
+            hmpc::iter::for_range<key_size>([&](auto i)
+            {
+                state[i] = param.key[i];
+            });
+            hmpc::iter::for_range<counter_size>([&](auto i)
+            {
+                state[i + key_size] = param.counter[i];
+            });
+            hmpc::iter::for_range<nonce_size>([&](auto i)
+            {
+                state[i + key_size + counter_size] = param.nonce[i];
+            });
+            expand_key();
+        }
+
+        constexpr block_type operator()() HMPC_NOEXCEPT
+        {
+            auto counter = state.span().template subspan<key_size, counter_size>();
+
+            hmpc::crypto::detail::aes_blocks<blocks> input;
+            hmpc::iter::for_range<blocks>([&](auto l)
+            {
+                hmpc::core::limb_array<counter_size, value_type> lane_counter;
+                hmpc::ints::num::add(lane_counter, counter, hmpc::core::size_limb_span<value_type>{l});
+                hmpc::iter::for_range<counter_size>([&](auto i)
+                {
+                    input[l][i] = lane_counter[i].data;
+                });
+                hmpc::iter::for_range<nonce_size>([&](auto i)
+                {
+                    input[l][counter_size + i] = state[key_size + counter_size + i].data;
+                });
+            });
+
+            hmpc::crypto::detail::aes_encrypt<rounds>(round_keys, input);
+
+            block_type result;
+            hmpc::iter::for_range<blocks>([&](auto l)
+            {
+                hmpc::iter::for_range<hmpc::size{4}>([&](auto i)
+                {
+                    result[4 * l + i] = value_type{input[l][i]};
+                });
+            });
+
+            hmpc::ints::num::add(
+                counter,
+                counter,
+                hmpc::core::size_limb_span<value_type>{blocks}
+            );
+
+            return result;
+        }
+    };
+
+    using aes128_ctr = aes_ctr<4, 3, 1>;
+    using aes256_ctr = aes_ctr<8, 3, 1>;
+}
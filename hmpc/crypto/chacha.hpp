@@ -3,11 +3,14 @@
 #include <hmpc/constants.hpp>
 #include <hmpc/core/bit_span.hpp>
 #include <hmpc/core/limb_array.hpp>
+#include <hmpc/core/size_limb_span.hpp>
 #include <hmpc/core/uint.hpp>
 #include <hmpc/ints/num/add.hpp>
 #include <hmpc/iter/for_packed_range.hpp>
 #include <hmpc/iter/for_range.hpp>
 
+#include <array>
+
 namespace hmpc::crypto::detail
 {
     constexpr void chacha_quarter_round(hmpc::core::uint32& a, hmpc::core::uint32& b, hmpc::core::uint32& c, hmpc::core::uint32& d) HMPC_NOEXCEPT
@@ -44,6 +47,51 @@ namespace hmpc::crypto::detail
         chacha_quarter_round(state[hmpc::size_constant_of<2>], state[hmpc::size_constant_of<7>], state[hmpc::size_constant_of<8>], state[hmpc::size_constant_of<13>]);
         chacha_quarter_round(state[hmpc::size_constant_of<3>], state[hmpc::size_constant_of<4>], state[hmpc::size_constant_of<9>], state[hmpc::size_constant_of<14>]);
     }
+
+    template<hmpc::size Lanes>
+    using chacha_lanes = std::array<hmpc::core::uint32, Lanes>;
+
+    /// a += b; d ^= a; d <<<= rotation (for all lanes)
+    template<hmpc::size Lanes, hmpc::rotate Rotation>
+    constexpr void chacha_lanes_step(chacha_lanes<Lanes>& a, chacha_lanes<Lanes> const& b, chacha_lanes<Lanes>& d, hmpc::rotate_constant<Rotation> rotation) HMPC_NOEXCEPT
+    {
+        hmpc::iter::for_range<Lanes>([&](auto l)
+        {
+            a[l] += b[l];
+        });
+        hmpc::iter::for_range<Lanes>([&](auto l)
+        {
+            d[l] ^= a[l];
+        });
+        hmpc::iter::for_range<Lanes>([&](auto l)
+        {
+            d[l] <<= rotation;
+        });
+    }
+
+    /// Same as `chacha_quarter_round`, but every step is applied to all lanes before the next one
+    template<hmpc::size Lanes>
+    constexpr void chacha_quarter_round(chacha_lanes<Lanes>& a, chacha_lanes<Lanes>& b, chacha_lanes<Lanes>& c, chacha_lanes<Lanes>& d) HMPC_NOEXCEPT
+    {
+        chacha_lanes_step(a, b, d, hmpc::constant_of<hmpc::rotate{16}>);
+        chacha_lanes_step(c, d, b, hmpc::constant_of<hmpc::rotate{12}>);
+        chacha_lanes_step(a, b, d, hmpc::constant_of<hmpc::rotate{8}>);
+        chacha_lanes_step(c, d, b, hmpc::constant_of<hmpc::rotate{7}>);
+    }
+
+    template<hmpc::size Lanes>
+    constexpr void chacha_double_round(std::array<chacha_lanes<Lanes>, 16>& state) HMPC_NOEXCEPT
+    {
+        hmpc::iter::for_range<hmpc::size{4}>([&](auto i)
+        {
+            chacha_quarter_round(state[i], state[i + 4], state[i + 8], state[i + 12]);
+        });
+
+        chacha_quarter_round(state[0], state[5], state[10], state[15]);
+        chacha_quarter_round(state[1], state[6], state[11], state[12]);
+        chacha_quarter_round(state[2], state[7], state[8], state[13]);
+        chacha_quarter_round(state[3], state[4], state[9], state[14]);
+    }
 }
 
 namespace hmpc::crypto
@@ -77,6 +125,8 @@ namespace hmpc::crypto
         static constexpr hmpc::size nonce_size = NonceSize;
         static constexpr hmpc::size constant_size = 4;
         static constexpr hmpc::size block_size = 16;
+        /// Number of counter values that one call advances the counter by
+        static constexpr hmpc::size counters_per_call = 1;
 
         using param_type = chacha_param<nonce_size, counter_size>;
         using value_type = hmpc::core::uint32;
@@ -165,4 +215,102 @@ namespace hmpc::crypto
             return result;
         }
     };
+
+    /// # Interleaved multi-block ChaCha
+    /// Computes `Blocks` consecutive ChaCha blocks (with counters c, c + 1, ..., c + Blocks - 1) in lockstep.
+    /// Every state word is kept for all blocks next to each other, so every step of the quarter round operates on `Blocks` independent lanes
+    /// (which the compiler can map to SIMD instructions).
+    /// The keystream is identical to `Blocks` calls of `chacha`, i.e., `multi_chacha` can replace `chacha` as engine of `hmpc::random::number_generator`.
+    /// Every call consumes `Blocks` counter values (see `counters_per_call`), so users that derive the counter from an index
+    /// (e.g., `hmpc::expr::crypto::cipher_storage` or the random number generators of `hmpc::comp::queue`) scale the index by `counters_per_call`.
+    template<hmpc::size Rounds, hmpc::size NonceSize, hmpc::size CounterSize, hmpc::size Blocks>
+    struct multi_chacha
+    {
+        static_assert(Blocks > 0);
+
+        using single_block_type = chacha<Rounds, NonceSize, CounterSize>;
+
+        static constexpr hmpc::size key_size = single_block_type::key_size;
+        static constexpr hmpc::size counter_size = single_block_type::counter_size;
+        static constexpr hmpc::size nonce_size = single_block_type::nonce_size;
+        static constexpr hmpc::size constant_size = single_block_type::constant_size;
+        static constexpr hmpc::size blocks = Blocks;
+        static constexpr hmpc::size block_size = single_block_type::block_size * blocks;
+        static constexpr hmpc::size counters_per_call = single_block_type::counters_per_call * blocks;
+
+        using param_type = single_block_type::param_type;
+        using value_type = single_block_type::value_type;
+        using block_type = hmpc::core::limb_array<block_size, value_type>;
+
+        single_block_type engine;
+
+        consteval multi_chacha(hmpc::compiletime_tag tag)
+            : engine(tag)
+        {
+        }
+
+        constexpr multi_chacha(param_type param) HMPC_NOEXCEPT
+            : engine(param)
+        {
+        }
+
+        constexpr param_type param() const noexcept
+        {
+            return engine.param();
+        }
+
+        constexpr void param(param_type param) HMPC_NOEXCEPT
+        {
+            engine.param(param);
+        }
+
+        constexpr block_type operator()() HMPC_NOEXCEPT
+        {
+            constexpr hmpc::size single_block_size = single_block_type::block_size;
+            using lanes_type = hmpc::crypto::detail::chacha_lanes<blocks>;
+
+            std::array<lanes_type, single_block_size> initial;
+            hmpc::iter::for_range<single_block_size>([&](auto i)
+            {
+                initial[i].fill(engine.state[i]);
+            });
+
+            auto counter = engine.state.span().template subspan<constant_size + key_size, counter_size>();
+            hmpc::iter::for_range<hmpc::size{1}, blocks>([&](auto l)
+            {
+                hmpc::core::limb_array<counter_size, value_type> lane_counter;
+                hmpc::ints::num::add(lane_counter, counter, hmpc::core::size_limb_span<value_type>{l});
+                hmpc::iter::for_range<counter_size>([&](auto i)
+                {
+                    initial[constant_size + key_size + i][l] = lane_counter[i];
+                });
+            });
+
+            auto state = initial;
+            hmpc::iter::for_range<Rounds / 2>([&](auto)
+            {
+                hmpc::crypto::detail::chacha_double_round(state);
+            });
+
+            block_type result;
+            hmpc::iter::for_range<blocks>([&](auto l)
+            {
+                hmpc::iter::for_range<single_block_size>([&](auto i)
+                {
+                    result[l * single_block_size + i] = state[i][l] + initial[i][l];
+                });
+            });
+
+            hmpc::ints::num::add(
+                counter,
+                counter,
+                hmpc::core::size_limb_span<value_type>{blocks}
+            );
+
+            return result;
+        }
+    };
+
+    template<hmpc::size Blocks>
+    using multi_chacha20 = multi_chacha<20, 3, 1, Blocks>;
 }
@@ -18,6 +18,7 @@ namespace hmpc::crypto
         static constexpr hmpc::size key_size = generator_type::key_size;
         static constexpr hmpc::size nonce_size = generator_type::nonce_size;
         static constexpr hmpc::size counter_size = generator_type::counter_size;
+        static constexpr hmpc::size counters_per_call = generator_type::counters_per_call;
 
         generator_type generator;
 
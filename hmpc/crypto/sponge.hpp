@@ -0,0 +1,92 @@
+#pragma once
+
+#include <hmpc/core/limb_array.hpp>
+#include <hmpc/core/uint.hpp>
+#include <hmpc/crypto/chacha.hpp>
+#include <hmpc/iter/for_range.hpp>
+
+#include <cstdint>
+#include <span>
+
+namespace hmpc::crypto
+{
+    /// # Sponge over the ChaCha permutation
+    /// Hash function (e.g., to derive Fiat-Shamir challenges) as a sponge [1] over the ChaCha permutation, i.e., `Rounds` rounds of the ChaCha block function without the final addition of the input.
+    /// Of the 16 state words, 8 words (256 bits) are the rate and 8 words (256 bits) are the capacity.
+    /// A sponge with capacity c is indifferentiable from a random oracle up to about 2^{c/2} permutation calls if the permutation is ideal [1], so collisions, preimages, and second preimages of the 256 bit digest cost 2^128 calls.
+    /// The ChaCha permutation is not ideal: it maps the all-zero state to itself and preserves states whose four columns are equal.
+    /// The capacity therefore starts with the ChaCha constants, which are never overwritten by input, so no reachable state has this structure (as for the ChaCha block function, whose security relies on the same constants).
+    /// Padding (10*1) is applied to the last, possibly empty, block, so distinct messages (sequences of words) give distinct padded inputs.
+    /// The digest has the size of a ChaCha key, e.g., to key a number generator with the hash of a transcript.
+    /// #### Algorithm reference
+    /// - [1] Guido Bertoni, Joan Daemen, Michaël Peeters, Gilles Van Assche: "Cryptographic sponge functions." Online, 2011. [Link](https://keccak.team/files/CSF-0.1.pdf), accessed 2024-06-10.
+    template<hmpc::size Rounds = 20>
+    struct chacha_sponge
+    {
+        static_assert(Rounds >= 8);
+        static_assert(Rounds % 2 == 0);
+
+        using value_type = hmpc::core::uint32;
+
+        static constexpr hmpc::size state_size = 16;
+        static constexpr hmpc::size rate = 8;
+        static constexpr hmpc::size digest_size = 8;
+
+        using state_type = hmpc::core::limb_array<state_size, value_type>;
+        using digest_type = hmpc::core::limb_array<digest_size, value_type>;
+
+        /// The capacity starts with the ChaCha constants (domain separation from the all-zero state)
+        state_type state = {0, 0, 0, 0, 0, 0, 0, 0, 0x6170'7865, 0x3320'646e, 0x7962'2d32, 0x6b20'6574, 0, 0, 0, 0};
+        hmpc::size position = 0;
+
+        constexpr void permute() HMPC_NOEXCEPT
+        {
+            hmpc::iter::for_range<Rounds / 2>([&](auto)
+            {
+                hmpc::crypto::detail::chacha_double_round(state.span());
+            });
+            position = 0;
+        }
+
+        constexpr void absorb(value_type word) HMPC_NOEXCEPT
+        {
+            state[position] ^= word;
+            ++position;
+            if (position == rate)
+            {
+                permute();
+            }
+        }
+
+        /// Absorbs limbs word by word (least significant word first)
+        template<typename Limb>
+        constexpr void absorb(std::span<Limb const> limbs) HMPC_NOEXCEPT
+        {
+            static_assert(Limb::bit_size % value_type::bit_size == 0);
+            constexpr hmpc::size words_per_limb = Limb::bit_size / value_type::bit_size;
+
+            for (auto limb : limbs)
+            {
+                hmpc::iter::for_range<words_per_limb>([&](auto i)
+                {
+                    absorb(value_type{static_cast<value_type::underlying_type>(limb.data >> (i * value_type::bit_size))});
+                });
+            }
+        }
+
+        /// Pads the input (10*1 padding) and returns the digest; absorbing more input afterwards starts a new (chained) message
+        constexpr digest_type digest() HMPC_NOEXCEPT
+        {
+            state[position] ^= value_type{1};
+            state[rate - 1] ^= value_type{0x8000'0000};
+            permute();
+
+            digest_type result;
+            hmpc::iter::for_range<digest_size>([&](auto i)
+            {
+                result[i] = state[i];
+            });
+            return result;
+        }
+    };
+}
@@ -12,12 +12,22 @@
         struct NAME##_specialization \
         { \
         }; \
+\
+        template<typename Value> \
+        struct NAME##_same_operands_specialization \
+        { \
+        }; \
     } \
     template<typename Left, typename Right> \
     concept NAME##_is_specialized = requires \
     { \
         traits::NAME##_specialization<Left, Right>::is_specialized; \
     }; \
+    template<typename Value> \
+    concept NAME##_same_operands_is_specialized = requires \
+    { \
+        traits::NAME##_same_operands_specialization<Value>::is_specialized; \
+    }; \
 \
     template<hmpc::expression Left, hmpc::expression Right> \
     struct NAME##_expression \
@@ -129,6 +139,11 @@
                     capabilities \
                 ); \
             } \
+            else if constexpr (std::same_as<left_type, right_type> and NAME##_same_operands_is_specialized<left_value_type>) \
+            { \
+                /* expressions of the same type are the same expression (cf. `hmpc::expr::cache`), so we only evaluate one operand */ \
+                return traits::NAME##_same_operands_specialization<left_value_type>::operator()(left_type::operator()(state.get(hmpc::constants::zero), index, capabilities)); \
+            } \
             else \
             { \
                 return left_type::operator()(state.get(hmpc::constants::zero), index, capabilities) OP right_type::operator()(state.get(hmpc::constants::one), index, capabilities); \
@@ -160,6 +175,25 @@ namespace hmpc::expr
     HMPC_BINARY_EXPRESSION(greater, >);
     HMPC_BINARY_EXPRESSION(less_equal, <=);
     HMPC_BINARY_EXPRESSION(greater_equal, >=);
+
+    namespace traits
+    {
+        /// `x * x` uses `square(x)` (if available), which is cheaper than a general multiplication
+        template<typename Value>
+            requires requires(Value const& value)
+            {
+                { square(value) } -> std::same_as<std::remove_cvref_t<decltype(value * value)>>;
+            }
+        struct multiply_same_operands_specialization<Value>
+        {
+            static constexpr bool is_specialized = true;
+
+            static constexpr auto operator()(Value const& value) HMPC_NOEXCEPT
+            {
+                return square(value);
+            }
+        };
+    }
 }
 
 #undef HMPC_BINARY_EXPRESSION
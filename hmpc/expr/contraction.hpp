@@ -0,0 +1,71 @@
+#pragma once
+
+#include <hmpc/ints/mod.hpp>
+#include <hmpc/shape.hpp>
+
+#include <algorithm>
+
+namespace hmpc::expr
+{
+    /// Sums of products (in matrix and matrix-vector products) with more terms than this are computed with a runtime loop instead of being unrolled at compile time
+    constexpr hmpc::size max_unrolled_contraction_extent = 64;
+
+    /// Number of products that a runtime loop accumulates lazily (see `hmpc::ints::traits::product_accumulator`) before it reduces them
+    constexpr hmpc::size contraction_block_size = 16;
+
+    namespace detail
+    {
+        /// Extent of the summed dimension, i.e., dimension `LeftDimension` of `LeftShape` and dimension `RightDimension` of `RightShape`.
+        /// This is `hmpc::dynamic_extent` if neither shape knows the extent at compile time.
+        template<typename LeftShape, hmpc::size LeftDimension, typename RightShape, hmpc::size RightDimension>
+        constexpr hmpc::size contraction_extent = []()
+        {
+            constexpr auto left = LeftShape::extent(hmpc::size_constant_of<LeftDimension>);
+            constexpr auto right = RightShape::extent(hmpc::size_constant_of<RightDimension>);
+            static_assert(left != hmpc::placeholder_extent);
+            static_assert(right != hmpc::placeholder_extent);
+            static_assert(left == right or left == hmpc::dynamic_extent or right == hmpc::dynamic_extent);
+            return (left == hmpc::dynamic_extent) ? right : left;
+        }();
+
+        /// Whether a sum of `Extent` products is computed with a runtime loop
+        template<hmpc::size Extent>
+        constexpr bool use_contraction_loop = Extent == hmpc::dynamic_extent or Extent > max_unrolled_contraction_extent;
+
+        /// Types for which sums of products can be computed in a runtime loop (the type of the sum does not depend on the number of terms)
+        template<typename Left, typename Right>
+        concept closed_contraction = requires(Left left, Right right)
+        {
+            { left * right + left * right } -> std::same_as<std::remove_cvref_t<decltype(left * right)>>;
+        };
+
+        /// Computes sum(product(k) for k < extent) in a runtime loop.
+        /// If `UseProductAccumulator` is set, blocks of `contraction_block_size` terms left(k) * right(k) are accumulated without intermediate reduction.
+        template<typename T, bool UseProductAccumulator>
+        constexpr T blocked_sum_of_products(hmpc::size extent, auto const& left, auto const& right, auto const& product) HMPC_NOEXCEPT
+        {
+            T sum = {};
+            for (hmpc::size block = 0; block < extent; block += contraction_block_size)
+            {
+                hmpc::size end = std::min(block + contraction_block_size, extent);
+                if constexpr (UseProductAccumulator)
+                {
+                    hmpc::ints::traits::product_accumulator_t<T, contraction_block_size> accumulator;
+                    for (hmpc::size k = block; k < end; ++k)
+                    {
+                        accumulator.multiply_add(left(k), right(k));
+                    }
+                    sum += accumulator.reduce();
+                }
+                else
+                {
+                    for (hmpc::size k = block; k < end; ++k)
+                    {
+                        sum += product(k);
+                    }
+                }
+            }
+            return sum;
+        }
+    }
+}
@@ -43,13 +43,15 @@ namespace hmpc::expr::crypto
             hmpc::ints::num::bit_copy(nonce, cipher.nonce);
         }
 
+        /// Cipher that starts at engine call `index` of the keystream, i.e., at counter `index * counters_per_call`
+        /// (engines that compute multiple blocks per call consume multiple counter values per call).
         constexpr auto cipher(hmpc::size index) const
         {
             HMPC_DEVICE_ASSERT(index >= 0);
             hmpc::core::limb_array<cipher_type::counter_size, limb_type> counter;
             hmpc::ints::num::bit_copy(
                 counter,
-                hmpc::core::size_limb_span<limb_type>{index}
+                hmpc::core::size_limb_span<limb_type>{index * cipher_type::counters_per_call}
             );
             auto param = param_type{
                 key.span(hmpc::access::read),
@@ -88,6 +90,7 @@ namespace hmpc::expr::crypto
         static constexpr hmpc::size block_size = engine_type::block_size;
         static constexpr hmpc::size batch_size = std::lcm(block_size, limb_size);
         static constexpr hmpc::size elements_per_batch = batch_size / limb_size;
+        /// Number of engine calls per batch
         static constexpr hmpc::size blocks_per_batch = batch_size / block_size;
 
         using cipher_expression_type = cipher_expression<engine_type>;
@@ -222,6 +225,7 @@ namespace hmpc::expr::crypto
         static constexpr hmpc::size block_size = engine_type::block_size;
         static constexpr hmpc::size batch_size = std::lcm(block_size, limb_size);
         static constexpr hmpc::size elements_per_batch = batch_size / limb_size;
+        /// Number of engine calls per batch
         static constexpr hmpc::size blocks_per_batch = batch_size / block_size;
 
         using cipher_expression_type = cipher_expression<engine_type>;
@@ -8,39 +8,85 @@
 #include <hmpc/expr/unsqueeze.hpp>
 #include <hmpc/ints/poly.hpp>
 
+#include <tuple>
+
 namespace hmpc::expr::crypto::lhe
 {
-    template<typename Plaintext, hmpc::expression Key, hmpc::expression C0, hmpc::expression C1>
-    constexpr auto dec(Key key, hmpc::expr::crypto::lhe::ciphertext_expression<C0, C1> ciphertext)
+    namespace detail
     {
-        using namespace hmpc::expr::operators;
+        /// c0 - s * c1 (in the number theoretic transform domain)
+        template<hmpc::expression Key, hmpc::expression C0, hmpc::expression C1>
+        constexpr auto noisy_plaintext(Key key, hmpc::expr::crypto::lhe::ciphertext_expression<C0, C1> ciphertext)
+        {
+            using namespace hmpc::expr::operators;
+
+            using poly_type = Key::value_type;
+            static_assert(poly_type::representation == hmpc::ints::number_theoretic_transform_representation);
 
-        using poly_type = Key::value_type;
-        static_assert(poly_type::representation == hmpc::ints::number_theoretic_transform_representation);
+            constexpr auto rank = C1::shape_type::rank;
+            static_assert(Key::shape_type::rank == 0);
 
-        constexpr auto rank = C1::shape_type::rank;
-        static_assert(Key::shape_type::rank == 0);
+            auto s = hmpc::iter::scan_range<rank>([](auto, auto s)
+            {
+                return hmpc::expr::unsqueeze(s, hmpc::constants::minus_one);
+            }, key);
 
-        auto s = hmpc::iter::scan_range<rank>([](auto, auto s)
+            return ciphertext.c0 - s * ciphertext.c1;
+        }
+
+        /// Reduces the (centered) coefficients of m + p * e modulo p
+        template<typename Plaintext, hmpc::expression E>
+        constexpr auto plaintext_from_coefficients(E coeff_x)
         {
-            return hmpc::expr::unsqueeze(s, hmpc::constants::minus_one);
-        }, key);
+            static_assert(E::value_type::representation == hmpc::ints::coefficient_representation);
+
+            if constexpr (Plaintext::representation == hmpc::ints::number_theoretic_transform_representation)
+            {
+                using coeff_type = hmpc::ints::traits::coefficient_type_t<Plaintext>;
+                return hmpc::expr::number_theoretic_transform(
+                    hmpc::expr::cast<coeff_type>(coeff_x)
+                );
+            }
+            else
+            {
+                static_assert(Plaintext::representation == hmpc::ints::coefficient_representation);
+                return hmpc::expr::cast<Plaintext>(coeff_x);
+            }
+        }
+    }
 
-        auto x = ciphertext.c0 - s * ciphertext.c1;
+    template<typename Plaintext, hmpc::expression Key, hmpc::expression C0, hmpc::expression C1>
+    constexpr auto dec(Key key, hmpc::expr::crypto::lhe::ciphertext_expression<C0, C1> ciphertext)
+    {
+        auto x = detail::noisy_plaintext(key, ciphertext);
 
         auto coeff_x = hmpc::expr::inverse_number_theoretic_transform(x);
 
-        if constexpr (Plaintext::representation == hmpc::ints::number_theoretic_transform_representation)
-        {
-            using coeff_type = hmpc::ints::traits::coefficient_type_t<Plaintext>;
-            return hmpc::expr::number_theoretic_transform(
-                hmpc::expr::cast<coeff_type>(coeff_x)
-            );
-        }
-        else
+        return detail::plaintext_from_coefficients<Plaintext>(coeff_x);
+    }
+
+    /// Decrypts multiple ciphertexts (of the same shape) and returns a `std::tuple` of the plaintexts.
+    /// All inverse (and forward) transforms are batched, i.e., they run in one chain of kernels.
+    template<typename Plaintext, hmpc::expression Key, hmpc::expression... C0, hmpc::expression... C1>
+        requires (sizeof...(C0) > 1)
+    constexpr auto dec(Key key, hmpc::expr::crypto::lhe::ciphertext_expression<C0, C1>... ciphertexts)
+    {
+        auto coeff_xs = hmpc::expr::batched_inverse_number_theoretic_transform(detail::noisy_plaintext(key, ciphertexts)...);
+
+        return std::apply([](auto... coeff_x)
         {
-            static_assert(Plaintext::representation == hmpc::ints::coefficient_representation);
-            return hmpc::expr::cast<Plaintext>(coeff_x);
-        }
+            if constexpr (Plaintext::representation == hmpc::ints::number_theoretic_transform_representation)
+            {
+                using coeff_type = hmpc::ints::traits::coefficient_type_t<Plaintext>;
+                return hmpc::expr::batched_number_theoretic_transform(
+                    hmpc::expr::cast<coeff_type>(coeff_x)...
+                );
+            }
+            else
+            {
+                static_assert(Plaintext::representation == hmpc::ints::coefficient_representation);
+                return std::make_tuple(hmpc::expr::cast<Plaintext>(coeff_x)...);
+            }
+        }, coeff_xs);
     }
 }
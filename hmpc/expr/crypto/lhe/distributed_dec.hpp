@@ -0,0 +1,68 @@
+#pragma once
+
+#include <hmpc/constant.hpp>
+#include <hmpc/expr/binary_expression.hpp>
+#include <hmpc/expr/constant.hpp>
+#include <hmpc/expr/crypto/lhe/ciphertext.hpp>
+#include <hmpc/expr/crypto/lhe/dec.hpp>
+#include <hmpc/expr/mpc/share.hpp>
+#include <hmpc/expr/number_theoretic_transform.hpp>
+#include <hmpc/expr/random/uniform.hpp>
+#include <hmpc/expr/unsqueeze.hpp>
+#include <hmpc/ints/poly.hpp>
+
+namespace hmpc::expr::crypto::lhe
+{
+    /// # Decryption share
+    /// For an additive share s_i of the secret key s (in number theoretic transform representation), computes c0 - s_i * c1 in coefficient representation
+    /// (only the first party of the communicator includes c0) and adds p * e_i, where e_i is from `drown_signed_uniform` with `Bound`.
+    /// The sum of all shares is m + p * (e + sum_i e_i) for the noise e of the ciphertext, i.e., `dec` of the sum yields m and the drowning terms statistically hide e (and thereby s).
+    /// `Bound` has to bound the coefficients of e, and p * (e + sum_i e_i) still has to be below q/2.
+    template<typename Plaintext, auto Tag = []{}, auto Bound, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security, hmpc::expression Key, hmpc::net::party_id Id, hmpc::net::party_id... Parties, hmpc::expression C0, hmpc::expression C1>
+    constexpr auto decryption_share(hmpc::expr::mpc::share_expression<Key, Id, Parties...> key, hmpc::expr::crypto::lhe::ciphertext_expression<C0, C1> ciphertext, hmpc::constant<decltype(Bound), Bound> bound = {}, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> security = {})
+    {
+        using namespace hmpc::expr::operators;
+
+        using poly_type = Key::value_type;
+        static_assert(poly_type::representation == hmpc::ints::number_theoretic_transform_representation);
+        using coeff_type = hmpc::ints::traits::coefficient_type_t<poly_type>;
+        using element_type = poly_type::element_type;
+
+        constexpr auto rank = C1::shape_type::rank;
+        static_assert(Key::shape_type::rank == 0);
+
+        auto s = hmpc::iter::scan_range<rank>([](auto, auto s)
+        {
+            return hmpc::expr::unsqueeze(s, hmpc::constants::minus_one);
+        }, key.value);
+
+        auto x = [&]()
+        {
+            if constexpr (hmpc::net::communicator_for<Parties...>.get(hmpc::constants::zero) == Id)
+            {
+                return ciphertext.c0 - s * ciphertext.c1;
+            }
+            else
+            {
+                return hmpc::expr::constant_of<hmpc::ints::integer_traits<element_type>::zero> - s * ciphertext.c1;
+            }
+        }();
+
+        constexpr auto p = hmpc::expr::constant(
+            hmpc::constant_cast<element_type>(
+                Plaintext::element_type::modulus_constant
+            )
+        );
+
+        auto e = hmpc::expr::random::drown_signed_uniform<coeff_type, Tag>(ciphertext.c1.shape(), bound, security);
+
+        return hmpc::expr::mpc::share(hmpc::expr::inverse_number_theoretic_transform(x) + e * p, key.id, key.communicator);
+    }
+
+    /// Decrypts the sum of all decryption shares (see `decryption_share`).
+    template<typename Plaintext, typename... Shares, hmpc::net::party_id... Parties>
+    constexpr auto dec(hmpc::expr::mpc::shares_expression<hmpc::net::communicator<Parties...>, Shares...> shares)
+    {
+        return detail::plaintext_from_coefficients<Plaintext>(shares.reconstruct());
+    }
+}
@@ -7,6 +7,7 @@
 #include <hmpc/expr/constant.hpp>
 #include <hmpc/expr/crypto/lhe/ciphertext.hpp>
 #include <hmpc/expr/crypto/lhe/key.hpp>
+#include <hmpc/expr/crypto/lhe/plaintext.hpp>
 #include <hmpc/expr/crypto/lhe/randomness.hpp>
 #include <hmpc/expr/expression.hpp>
 #include <hmpc/expr/number_theoretic_transform.hpp>
@@ -16,6 +17,10 @@
 
 namespace hmpc::expr::crypto::lhe
 {
+    /// Encrypts `plaintext` with `key` and `randomness`.
+    /// Fresh randomness (e.g., from `randomness<T>(shape)`) is sampled while evaluating the ciphertext and is not available afterwards;
+    /// evaluating `randomness.u`, `.v`, or `.w` in a separate queue call samples new values.
+    /// If the randomness is needed again (e.g., as the witness for `prove`), evaluate it first and pass the resulting tensors with `randomness(u, v, w)` or `randomness(r)`.
     template<hmpc::expression A, hmpc::expression B, hmpc::expression Plaintext, hmpc::expression U, hmpc::expression V, hmpc::expression W>
     constexpr auto enc(hmpc::expr::crypto::lhe::key_expression<A, B> key, Plaintext plaintext, hmpc::expr::crypto::lhe::randomness_expression<U, V, W> randomness)
     {
@@ -40,25 +45,75 @@ namespace hmpc::expr::crypto::lhe
 
         using plaintext_type = Plaintext::value_type;
 
-        auto message = hmpc::expr::number_theoretic_transform(
-            hmpc::expr::cast<coeff_type>(
-                [&]()
-                {
-                    if constexpr (plaintext_type::representation == hmpc::ints::number_theoretic_transform_representation)
-                    {
-                        return hmpc::expr::inverse_number_theoretic_transform(plaintext);
-                    }
-                    else
-                    {
-                        return plaintext;
-                    }
-                }()
+        auto coeff_message = detail::coefficient_plaintext<coeff_type>(plaintext);
+
+        constexpr auto p = hmpc::expr::constant(
+            hmpc::constant_cast<typename poly_type::element_type>(
+                plaintext_type::element_type::modulus_constant
             )
         );
 
+        using coeff_message_type = decltype(coeff_message);
+        using coeff_u_type = decltype(hmpc::expr::inverse_number_theoretic_transform(randomness.u));
+        using coeff_v_type = decltype(hmpc::expr::inverse_number_theoretic_transform(randomness.v));
+        using coeff_w_type = decltype(hmpc::expr::inverse_number_theoretic_transform(randomness.w));
+
+        // If the randomness is not transformed yet (e.g., fresh from `randomness`), we transform it together with the message in one batch
+        if constexpr (
+            hmpc::expr::traits::is_number_theoretic_transform_v<U> and hmpc::expr::traits::is_number_theoretic_transform_v<V> and hmpc::expr::traits::is_number_theoretic_transform_v<W>
+            and std::same_as<typename coeff_message_type::value_type, typename coeff_u_type::value_type> and std::same_as<typename coeff_message_type::value_type, typename coeff_v_type::value_type> and std::same_as<typename coeff_message_type::value_type, typename coeff_w_type::value_type>
+            and std::same_as<typename coeff_message_type::shape_type, typename coeff_u_type::shape_type> and std::same_as<typename coeff_message_type::shape_type, typename coeff_v_type::shape_type> and std::same_as<typename coeff_message_type::shape_type, typename coeff_w_type::shape_type>
+        )
+        {
+            auto [message, u, v, w] = hmpc::expr::batched_number_theoretic_transform(
+                coeff_message,
+                hmpc::expr::inverse_number_theoretic_transform(randomness.u),
+                hmpc::expr::inverse_number_theoretic_transform(randomness.v),
+                hmpc::expr::inverse_number_theoretic_transform(randomness.w)
+            );
+
+            return ciphertext_expression{
+                a * u + v * p + message,
+                b * u + w * p
+            };
+        }
+        else
+        {
+            auto message = hmpc::expr::number_theoretic_transform(coeff_message);
+
+            return ciphertext_expression{
+                a * randomness.u + randomness.v * p + message,
+                b * randomness.u + randomness.w * p
+            };
+        }
+    }
+
+    /// Encrypts a message that is already lifted to the ciphertext ring (in number theoretic transform representation) with the plaintext modulus of `Plaintext`.
+    /// Unlike `enc`, the message is not reduced modulo p, so this is linear over the ciphertext ring, e.g., to check linear relations of ciphertexts (see `verify`).
+    template<typename Plaintext, hmpc::expression A, hmpc::expression B, hmpc::expression Message, hmpc::expression U, hmpc::expression V, hmpc::expression W>
+    constexpr auto enc_lifted(hmpc::expr::crypto::lhe::key_expression<A, B> key, Message message, hmpc::expr::crypto::lhe::randomness_expression<U, V, W> randomness)
+    {
+        using poly_type = A::value_type;
+        static_assert(poly_type::representation == hmpc::ints::number_theoretic_transform_representation);
+        static_assert(std::same_as<typename Message::value_type, poly_type>);
+
+        constexpr auto rank = decltype(hmpc::common_shape(message.shape(), randomness.u.shape()))::rank;
+
+        auto a = hmpc::iter::scan_range<rank>([](auto, auto a)
+        {
+            return hmpc::expr::unsqueeze(a, hmpc::constants::minus_one);
+        }, key.get(hmpc::constants::zero));
+
+        auto b = hmpc::iter::scan_range<rank>([](auto, auto b)
+        {
+            return hmpc::expr::unsqueeze(b, hmpc::constants::minus_one);
+        }, key.get(hmpc::constants::one));
+
+        using namespace hmpc::expr::operators;
+
         constexpr auto p = hmpc::expr::constant(
             hmpc::constant_cast<typename poly_type::element_type>(
-                plaintext_type::element_type::modulus_constant
+                hmpc::traits::element_type_t<Plaintext>::modulus_constant
             )
         );
 
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <hmpc/expr/expression.hpp>
+#include <hmpc/expr/number_theoretic_transform.hpp>
+#include <hmpc/ints/poly.hpp>
+#include <hmpc/shape.hpp>
+
+namespace hmpc::expr::crypto::lhe
+{
+    /// # Slot packing
+    /// For a plaintext modulus p = 1 (mod 2N), X^N + 1 splits into N linear factors modulo p.
+    /// By the Chinese remainder theorem, R_p is then isomorphic to N copies of Z_p (the slots),
+    /// and this isomorphism is exactly the number theoretic transform modulo p.
+    /// Hence, the last dimension (of extent N) of `E` (with `mod<p>` elements) becomes the slots of a plaintext polynomial `Plaintext` in number theoretic transform representation.
+    /// Homomorphic additions and multiplications (with plaintexts) of packed ciphertexts act slot-wise.
+    template<typename Plaintext, hmpc::expression E>
+    struct encode_expression
+    {
+        using inner_type = E;
+        using value_type = Plaintext;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using inner_shape_type = inner_type::shape_type;
+        using shape_type = decltype(hmpc::squeeze(std::declval<inner_shape_type>(), hmpc::constants::minus_one, hmpc::force));
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        static constexpr auto slot_count = hmpc::traits::vector_size_v<value_type>;
+
+        static_assert(value_type::representation == hmpc::ints::number_theoretic_transform_representation);
+        static_assert(std::same_as<typename inner_type::value_type, element_type>);
+        static_assert(inner_shape_type::rank > 0);
+        static_assert(inner_shape_type::extent(hmpc::size_constant_of<inner_shape_type::rank - 1>) == slot_count or inner_shape_type::extent(hmpc::size_constant_of<inner_shape_type::rank - 1>) == hmpc::dynamic_extent);
+
+        static constexpr hmpc::size arity = 1;
+
+        inner_type inner;
+
+        constexpr encode_expression(inner_type const& inner) HMPC_NOEXCEPT
+            : inner(inner)
+        {
+            HMPC_HOST_ASSERT(inner.shape().get(hmpc::size_constant_of<inner_shape_type::rank - 1>) == slot_count);
+        }
+
+        constexpr inner_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return inner;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::squeeze(inner.shape(), hmpc::constants::minus_one, hmpc::force);
+        }
+
+        static constexpr element_type operator()(hmpc::state_with_arity<1> auto const& state, hmpc::mdindex_for<element_shape_type> auto const& index, auto& capabilities) HMPC_NOEXCEPT
+        {
+            // the element shape of a polynomial tensor is its shape with the slots as last dimension
+            return inner_type::operator()(state.get(hmpc::constants::zero), index, capabilities);
+        }
+    };
+
+    /// # Slot unpacking
+    /// Inverse of `encode_expression`: the slots of a plaintext polynomial (in number theoretic transform representation) become the last dimension (of extent N) of a `mod<p>` tensor.
+    template<hmpc::expression E>
+    struct decode_expression
+    {
+        using inner_type = E;
+        using inner_value_type = inner_type::value_type;
+        using value_type = hmpc::traits::element_type_t<inner_value_type>;
+        using element_type = value_type;
+        using inner_shape_type = inner_type::shape_type;
+
+        static constexpr auto slot_count = hmpc::traits::vector_size_v<inner_value_type>;
+
+        using shape_type = decltype(hmpc::unsqueeze(std::declval<inner_shape_type>(), hmpc::constants::minus_one, hmpc::size_constant_of<slot_count>));
+        using element_shape_type = shape_type;
+
+        static_assert(inner_value_type::representation == hmpc::ints::number_theoretic_transform_representation);
+
+        static constexpr hmpc::size arity = 1;
+
+        inner_type inner;
+
+        constexpr decode_expression(inner_type const& inner) HMPC_NOEXCEPT
+            : inner(inner)
+        {
+        }
+
+        constexpr inner_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return inner;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::unsqueeze(inner.shape(), hmpc::constants::minus_one, hmpc::size_constant_of<slot_count>);
+        }
+
+        static constexpr element_type operator()(hmpc::state_with_arity<1> auto const& state, hmpc::mdindex_for<element_shape_type> auto const& index, auto& capabilities) HMPC_NOEXCEPT
+        {
+            return inner_type::operator()(state.get(hmpc::constants::zero), index, capabilities);
+        }
+    };
+
+    /// Packs the last dimension (of extent N) of `e` into the slots of plaintexts `Plaintext` (in either representation).
+    template<typename Plaintext, hmpc::expression E>
+    constexpr auto encode(E const& e) HMPC_NOEXCEPT
+    {
+        using ntt_type = hmpc::ints::traits::number_theoretic_transform_type_t<Plaintext>;
+        auto packed = encode_expression<ntt_type, E>{e};
+
+        if constexpr (Plaintext::representation == hmpc::ints::number_theoretic_transform_representation)
+        {
+            return packed;
+        }
+        else
+        {
+            static_assert(Plaintext::representation == hmpc::ints::coefficient_representation);
+            return hmpc::expr::inverse_number_theoretic_transform(packed);
+        }
+    }
+
+    /// Unpacks the slots of plaintexts `e` (in either representation) into the last dimension (of extent N) of a `mod<p>` expression.
+    template<hmpc::expression E>
+    constexpr auto decode(E const& e) HMPC_NOEXCEPT
+    {
+        using plaintext_type = E::value_type;
+
+        if constexpr (plaintext_type::representation == hmpc::ints::number_theoretic_transform_representation)
+        {
+            return decode_expression<E>{e};
+        }
+        else
+        {
+            static_assert(plaintext_type::representation == hmpc::ints::coefficient_representation);
+            auto packed = hmpc::expr::number_theoretic_transform(e);
+            return decode_expression<decltype(packed)>{packed};
+        }
+    }
+}
@@ -3,7 +3,10 @@
 #include <hmpc/comp/crypto/lhe/key.hpp>
 #include <hmpc/detail/unique_tag.hpp>
 #include <hmpc/expr/expression.hpp>
+#include <hmpc/expr/random/number_generator.hpp>
+#include <hmpc/expr/random/uniform_from_number_generator.hpp>
 #include <hmpc/expr/tensor.hpp>
+#include <hmpc/ints/poly.hpp>
 
 namespace hmpc::expr::crypto::lhe
 {
@@ -46,4 +49,26 @@ namespace hmpc::expr::crypto::lhe
             hmpc::expr::tensor<hmpc::detail::unique_tag(Tag, hmpc::constants::one)>(key.b)
         };
     }
+
+    /// Expands the uniformly random key component `a` (in number theoretic transform representation) from `seed`.
+    /// Every coefficient is generated from the keystream of `Engine` (keyed with `seed`) independently, i.e., `a` can be regenerated on demand.
+    template<typename Poly, auto Tag = []{}, hmpc::random::engine Engine = hmpc::default_random_engine>
+    constexpr auto seeded_a(hmpc::core::limb_span<Engine::key_size, typename Engine::value_type, hmpc::access::read_tag> seed)
+    {
+        static_assert(Poly::representation == hmpc::ints::number_theoretic_transform_representation);
+        return hmpc::expr::random::uniform<Poly, Engine, hmpc::default_statistical_security, decltype(Tag)>(
+            hmpc::expr::random::number_generator<Engine>(seed, hmpc::index{0}, hmpc::shape{1}),
+            hmpc::shape{}
+        );
+    }
+
+    /// Key with `a` expanded from the seed of `key` (see `seeded_a`)
+    template<auto Tag = []{}, typename T, typename Engine>
+    constexpr auto key(hmpc::comp::crypto::lhe::compressed_key<T, Engine>& key)
+    {
+        return key_expression{
+            seeded_a<T, hmpc::detail::unique_tag(Tag, hmpc::constants::zero), Engine>(key.seed.span(hmpc::access::read)),
+            hmpc::expr::tensor<hmpc::detail::unique_tag(Tag, hmpc::constants::one)>(key.b)
+        };
+    }
 }
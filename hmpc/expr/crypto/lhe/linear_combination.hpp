@@ -0,0 +1,192 @@
+#pragma once
+
+#include <hmpc/comp/accessor.hpp>
+#include <hmpc/expr/cache.hpp>
+#include <hmpc/expr/crypto/lhe/ciphertext.hpp>
+#include <hmpc/expr/expression.hpp>
+#include <hmpc/expr/matrix_vector_product.hpp>
+#include <hmpc/expr/number_theoretic_transform.hpp>
+#include <hmpc/ints/mod.hpp>
+#include <hmpc/ints/poly.hpp>
+
+namespace hmpc::expr::crypto::lhe
+{
+    /// # Matrix of plaintexts times vector of ciphertexts
+    /// Computes sum_k M[..., i, k] * c[..., k] for both ciphertext components in one kernel (in the number theoretic transform domain).
+    /// Every work item reads each matrix coefficient once and accumulates both components with lazy reduction (see `hmpc::ints::traits::product_accumulator`).
+    /// The result has a leading dimension of extent 2 (one per ciphertext component); see `matrix_vector_product`.
+    template<hmpc::expression Matrix, hmpc::expression C0, hmpc::expression C1>
+    struct matrix_ciphertext_product_expression : public hmpc::expr::enable_caching
+    {
+        using enable_caching::operator();
+
+        using matrix_type = Matrix;
+        using c0_type = C0;
+        using c1_type = C1;
+
+        using value_type = matrix_type::value_type;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+
+        static_assert(value_type::representation == hmpc::ints::number_theoretic_transform_representation);
+        static_assert(std::same_as<typename c0_type::value_type, value_type>);
+        static_assert(std::same_as<typename c1_type::value_type, value_type>);
+        static_assert(std::same_as<typename c0_type::shape_type, typename c1_type::shape_type>);
+
+        using matrix_shape_type = matrix_type::shape_type;
+        using vector_shape_type = c0_type::shape_type;
+
+        static constexpr hmpc::size matrix_rank = matrix_shape_type::rank;
+        static constexpr hmpc::size vector_rank = vector_shape_type::rank;
+        static_assert(matrix_rank == vector_rank + 1);
+        static_assert(matrix_rank >= 2);
+        static constexpr hmpc::size sum_extent = []()
+        {
+            constexpr auto u_index = hmpc::size_constant_of<matrix_rank - 2>;
+            constexpr auto v_index = hmpc::size_constant_of<matrix_rank - 1>;
+            constexpr auto extent = matrix_shape_type::extent(v_index);
+            static_assert(extent == vector_shape_type::extent(u_index));
+            static_assert(extent != hmpc::placeholder_extent);
+            static_assert(extent != hmpc::dynamic_extent);
+            return extent;
+        }();
+
+        static constexpr bool use_product_accumulator = hmpc::ints::has_product_accumulator<element_type, sum_extent>;
+
+        using product_shape_type = decltype(hmpc::expr::matrix_vector_product_shape(std::declval<matrix_shape_type>(), std::declval<vector_shape_type>()));
+        using shape_type = decltype(hmpc::unsqueeze(std::declval<product_shape_type>(), hmpc::constants::zero, hmpc::constants::two));
+
+        static constexpr hmpc::size arity = 3;
+        using is_complex = void;
+
+        matrix_type matrix;
+        c0_type c0;
+        c1_type c1;
+
+        constexpr matrix_ciphertext_product_expression(matrix_type matrix, c0_type c0, c1_type c1) HMPC_NOEXCEPT
+            : matrix(matrix)
+            , c0(c0)
+            , c1(c1)
+        {
+        }
+
+        constexpr matrix_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return matrix;
+        }
+
+        constexpr c0_type const& get(hmpc::size_constant<1>) const HMPC_NOEXCEPT
+        {
+            return c0;
+        }
+
+        constexpr c1_type const& get(hmpc::size_constant<2>) const HMPC_NOEXCEPT
+        {
+            return c1;
+        }
+
+        static constexpr hmpc::access::multiple_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        static constexpr hmpc::access::multiple_tag access(hmpc::size_constant<1>) noexcept
+        {
+            return {};
+        }
+
+        static constexpr hmpc::access::multiple_tag access(hmpc::size_constant<2>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto product_shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::expr::matrix_vector_product_shape(matrix.shape(), hmpc::common_shape(c0.shape(), c1.shape()));
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::unsqueeze(product_shape(), hmpc::constants::zero, hmpc::constants::two);
+        }
+
+        constexpr auto operator()(auto& sycl_queue, auto& get_state, auto& get_capability_data, auto& make_capabilities, auto& tensor, auto&) const HMPC_NOEXCEPT
+        {
+            return sycl_queue.submit([&](auto& handler)
+            {
+                auto state = get_state(handler);
+                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                auto element_shape = hmpc::element_shape<value_type>(product_shape());
+                auto element_count = element_shape.size();
+                auto capability_data = get_capability_data(element_shape);
+
+                handler.parallel_for(sycl::range{element_count}, [=](hmpc::size id)
+                {
+                    auto index = hmpc::from_linear_index(id, element_shape);
+                    constexpr auto index_rank = decltype(index)::rank;
+                    auto capabilities = make_capabilities(capability_data, index, element_shape);
+
+                    auto matrix_index = [&](auto k)
+                    {
+                        return hmpc::iter::for_packed_range<matrix_rank - 1>([&](auto... i)
+                        {
+                            return hmpc::iter::for_packed_range<matrix_rank - 1, index_rank>([&](auto... j)
+                            {
+                                return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            });
+                        });
+                    };
+
+                    auto vector_index = [&](auto k)
+                    {
+                        return hmpc::iter::for_packed_range<vector_rank - 1>([&](auto... i)
+                        {
+                            return hmpc::iter::for_packed_range<vector_rank, index_rank>([&](auto... j)
+                            {
+                                return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            });
+                        });
+                    };
+
+                    if constexpr (use_product_accumulator)
+                    {
+                        hmpc::ints::traits::product_accumulator_t<element_type, sum_extent> accumulator0;
+                        hmpc::ints::traits::product_accumulator_t<element_type, sum_extent> accumulator1;
+                        hmpc::iter::for_range<sum_extent>([&](auto k)
+                        {
+                            element_type m = matrix_type::operator()(state.get(hmpc::constants::zero), matrix_index(k), capabilities);
+                            accumulator0.multiply_add(m, c0_type::operator()(state.get(hmpc::constants::one), vector_index(k), capabilities));
+                            accumulator1.multiply_add(m, c1_type::operator()(state.get(hmpc::constants::two), vector_index(k), capabilities));
+                        });
+                        write[id] = accumulator0.reduce();
+                        write[element_count + id] = accumulator1.reduce();
+                    }
+                    else
+                    {
+                        element_type sum0 = {};
+                        element_type sum1 = {};
+                        hmpc::iter::for_range<sum_extent>([&](auto k)
+                        {
+                            element_type m = matrix_type::operator()(state.get(hmpc::constants::zero), matrix_index(k), capabilities);
+                            sum0 += m * c0_type::operator()(state.get(hmpc::constants::one), vector_index(k), capabilities);
+                            sum1 += m * c1_type::operator()(state.get(hmpc::constants::two), vector_index(k), capabilities);
+                        });
+                        write[id] = sum0;
+                        write[element_count + id] = sum1;
+                    }
+                });
+            });
+        }
+    };
+
+    /// Homomorphically computes the matrix-vector product of a matrix of (lifted) plaintexts `matrix` and a vector of ciphertexts in one pass over the ciphertexts.
+    /// Use `plaintext` to lift plaintexts to the ciphertext ring.
+    template<hmpc::expression Matrix, hmpc::expression C0, hmpc::expression C1>
+    constexpr auto matrix_vector_product(Matrix matrix, hmpc::expr::crypto::lhe::ciphertext_expression<C0, C1> ciphertext)
+    {
+        auto product = matrix_ciphertext_product_expression<Matrix, C0, C1>{matrix, ciphertext.c0, ciphertext.c1};
+        return ciphertext_expression{
+            hmpc::expr::batch_get_expression{product, hmpc::constants::zero},
+            hmpc::expr::batch_get_expression{product, hmpc::constants::one}
+        };
+    }
+}
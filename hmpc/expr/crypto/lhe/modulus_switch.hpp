@@ -0,0 +1,168 @@
+#pragma once
+
+#include <hmpc/constant.hpp>
+#include <hmpc/expr/binary_expression.hpp>
+#include <hmpc/expr/cast.hpp>
+#include <hmpc/expr/constant.hpp>
+#include <hmpc/expr/crypto/lhe/ciphertext.hpp>
+#include <hmpc/expr/crypto/lhe/dec.hpp>
+#include <hmpc/expr/expression.hpp>
+#include <hmpc/expr/number_theoretic_transform.hpp>
+#include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/mod.hpp>
+#include <hmpc/ints/numeric.hpp>
+#include <hmpc/ints/poly.hpp>
+
+#include <tuple>
+
+namespace hmpc::expr::crypto::lhe
+{
+    namespace detail
+    {
+        /// # Modulus switching factor
+        /// Decrypting a ciphertext that was switched from modulus q (`Source`) to modulus q' (`Target`) yields the plaintext times q' * q^{-1} mod p (`Plaintext`).
+        template<typename Plaintext, typename Source, typename Target>
+        constexpr Plaintext modulus_switch_factor = Plaintext{Target::modulus} * invert(Plaintext{Source::modulus});
+    }
+
+    /// # Modulus switching (scale and round)
+    /// For a coefficient c in [0,q), computes c' ~ c * q' / q with c' = c * q' * q^{-1} (mod p) and |c' - c * q' / q| <= p / 2 + 1.
+    /// The quotient floor(c * q' / q) is computed in constant time (see `hmpc::ints::num::divide` with a compile-time denominator).
+    /// Then, the quotient is corrected by the centered difference to c * q' * q^{-1} mod p, so that decryption with the lifted key (see `switch_key`)
+    /// only changes the plaintext by the factor `detail::modulus_switch_factor` and the noise by at most (p / 2 + 1) * (1 + ||s||_1).
+    template<hmpc::value T, typename Plaintext, hmpc::expression E>
+        requires (hmpc::traits::vector_size_v<T> == hmpc::traits::vector_size_v<typename E::value_type>)
+    struct modulus_switch_expression
+    {
+        using inner_type = E;
+        using value_type = T;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using shape_type = inner_type::shape_type;
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        using source_type = hmpc::traits::element_type_t<typename inner_type::value_type>;
+        using plaintext_type = hmpc::traits::element_type_t<Plaintext>;
+
+        static_assert(value_type::representation == hmpc::ints::coefficient_representation);
+        static_assert(inner_type::value_type::representation == hmpc::ints::coefficient_representation);
+        static_assert(element_type::modulus < source_type::modulus);
+        static_assert(plaintext_type::modulus < element_type::half_modulus);
+
+        static constexpr plaintext_type factor = detail::modulus_switch_factor<plaintext_type, source_type, element_type>;
+
+        static constexpr hmpc::size arity = 1;
+
+        inner_type inner;
+
+        constexpr modulus_switch_expression(inner_type const& inner) HMPC_NOEXCEPT
+            : inner(inner)
+        {
+        }
+
+        constexpr inner_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return inner;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return inner.shape();
+        }
+
+        static constexpr element_type operator()(hmpc::state_with_arity<1> auto const& state, hmpc::index_for<element_shape_type> auto const& index, auto& capabilities) HMPC_NOEXCEPT
+        {
+            auto value = static_cast<source_type::unsigned_type>(inner_type::operator()(state.get(hmpc::constants::zero), index, capabilities));
+
+            // floor(c * q' / q) < q'
+            auto [quotient, remainder] = hmpc::ints::divide(value * element_type::modulus, source_type::modulus_constant);
+            auto scaled = hmpc::ints::num::bit_copy<typename element_type::unsigned_type>(quotient);
+
+            // (c * q' * q^{-1} - floor(c * q' / q)) mod p in [0,p)
+            auto correction = static_cast<plaintext_type::unsigned_type>(plaintext_type{value} * factor - plaintext_type{scaled});
+
+            // subtract p if the correction is larger than p / 2, i.e., round to the closest value
+            auto sum = scaled + correction;
+            hmpc::ints::sbigint<decltype(sum)::bit_size + 1, typename element_type::limb_type> rounded;
+            hmpc::core::num::subtract(
+                rounded.span(hmpc::access::write),
+                sum.span(hmpc::access::read),
+                plaintext_type::modulus_span.mask(
+                    hmpc::ints::num::greater(correction, plaintext_type::half_modulus_span)
+                )
+            );
+
+            return element_type{rounded};
+        }
+    };
+
+    /// Switches coefficients of `e` (in coefficient representation) to the modulus of `T` (see `modulus_switch_expression`).
+    template<hmpc::value T, typename Plaintext, hmpc::expression E>
+    constexpr auto modulus_switch(E const& e) HMPC_NOEXCEPT
+    {
+        return modulus_switch_expression<T, Plaintext, E>{e};
+    }
+
+    /// # Modulus switching of ciphertexts
+    /// Scales and rounds a ciphertext over R_q down to a ciphertext over the smaller ring `Poly` (in number theoretic transform representation).
+    /// The result is an ordinary ciphertext over `Poly`, i.e., it can be sent (and received) like any other ciphertext but with fewer limbs per coefficient.
+    /// To decrypt, lift the secret key with `switch_key` and use `dec_switched`.
+    template<typename Poly, typename Plaintext, hmpc::expression C0, hmpc::expression C1>
+    constexpr auto switch_modulus(hmpc::expr::crypto::lhe::ciphertext_expression<C0, C1> ciphertext)
+    {
+        static_assert(Poly::representation == hmpc::ints::number_theoretic_transform_representation);
+        using coeff_type = hmpc::ints::traits::coefficient_type_t<Poly>;
+
+        if constexpr (std::same_as<typename C0::shape_type, typename C1::shape_type>)
+        {
+            auto [c0, c1] = hmpc::expr::batched_inverse_number_theoretic_transform(ciphertext.c0, ciphertext.c1);
+            auto [switched_c0, switched_c1] = hmpc::expr::batched_number_theoretic_transform(
+                modulus_switch<coeff_type, Plaintext>(c0),
+                modulus_switch<coeff_type, Plaintext>(c1)
+            );
+            return ciphertext_expression{switched_c0, switched_c1};
+        }
+        else
+        {
+            return ciphertext_expression{
+                hmpc::expr::number_theoretic_transform(modulus_switch<coeff_type, Plaintext>(hmpc::expr::inverse_number_theoretic_transform(ciphertext.c0))),
+                hmpc::expr::number_theoretic_transform(modulus_switch<coeff_type, Plaintext>(hmpc::expr::inverse_number_theoretic_transform(ciphertext.c1)))
+            };
+        }
+    }
+
+    /// Lifts a (small) secret key to the ring `Poly` (in number theoretic transform representation), e.g., to decrypt ciphertexts after `switch_modulus`.
+    /// Coefficients are interpreted as signed values (see the `hmpc::ints::mod` constructor from other mods).
+    template<typename Poly, hmpc::expression Key>
+    constexpr auto switch_key(Key key)
+    {
+        static_assert(Poly::representation == hmpc::ints::number_theoretic_transform_representation);
+        using coeff_type = hmpc::ints::traits::coefficient_type_t<Poly>;
+
+        return hmpc::expr::number_theoretic_transform(
+            hmpc::expr::cast<coeff_type>(hmpc::expr::inverse_number_theoretic_transform(key))
+        );
+    }
+
+    /// Decrypts a ciphertext that was switched from the ring `Source` with `switch_modulus` (using a key lifted with `switch_key`).
+    /// This removes the factor q' * q^{-1} mod p (see `detail::modulus_switch_factor`).
+    template<typename Plaintext, typename Source, hmpc::expression Key, hmpc::expression C0, hmpc::expression C1>
+    constexpr auto dec_switched(Key key, hmpc::expr::crypto::lhe::ciphertext_expression<C0, C1> ciphertext)
+    {
+        using namespace hmpc::expr::operators;
+
+        using plaintext_element_type = hmpc::traits::element_type_t<Plaintext>;
+        using source_element_type = hmpc::traits::element_type_t<Source>;
+        using target_element_type = hmpc::traits::element_type_t<typename C0::value_type>;
+
+        constexpr auto inverse_factor = hmpc::expr::constant_of<
+            invert(detail::modulus_switch_factor<plaintext_element_type, source_element_type, target_element_type>)
+        >;
+
+        return dec<Plaintext>(key, ciphertext) * inverse_factor;
+    }
+}
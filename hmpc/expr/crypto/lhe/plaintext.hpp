@@ -0,0 +1,47 @@
+#pragma once
+
+#include <hmpc/expr/cast.hpp>
+#include <hmpc/expr/expression.hpp>
+#include <hmpc/expr/number_theoretic_transform.hpp>
+#include <hmpc/ints/poly.hpp>
+
+namespace hmpc::expr::crypto::lhe
+{
+    namespace detail
+    {
+        /// Plaintext (in either representation) as polynomial `Coeff` (in coefficient representation)
+        template<typename Coeff, hmpc::expression Plaintext>
+        constexpr auto coefficient_plaintext(Plaintext plaintext)
+        {
+            static_assert(Coeff::representation == hmpc::ints::coefficient_representation);
+            using plaintext_type = Plaintext::value_type;
+
+            return hmpc::expr::cast<Coeff>(
+                [&]()
+                {
+                    if constexpr (plaintext_type::representation == hmpc::ints::number_theoretic_transform_representation)
+                    {
+                        return hmpc::expr::inverse_number_theoretic_transform(plaintext);
+                    }
+                    else
+                    {
+                        return plaintext;
+                    }
+                }()
+            );
+        }
+    }
+
+    /// Lifts a plaintext (in either representation) to the ciphertext polynomial `Poly` (in number theoretic transform representation),
+    /// e.g., to multiply it with ciphertexts.
+    template<typename Poly, hmpc::expression Plaintext>
+    constexpr auto plaintext(Plaintext plaintext)
+    {
+        static_assert(Poly::representation == hmpc::ints::number_theoretic_transform_representation);
+        using coeff_type = hmpc::ints::traits::coefficient_type_t<Poly>;
+
+        return hmpc::expr::number_theoretic_transform(
+            detail::coefficient_plaintext<coeff_type>(plaintext)
+        );
+    }
+}
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <hmpc/comp/accessor.hpp>
+#include <hmpc/comp/crypto/lhe/ciphertext.hpp>
+#include <hmpc/comp/crypto/lhe/key.hpp>
+#include <hmpc/comp/crypto/lhe/proof.hpp>
+#include <hmpc/comp/crypto/lhe/randomness.hpp>
+#include <hmpc/core/size_limb_span.hpp>
+#include <hmpc/crypto/sponge.hpp>
+#include <hmpc/expr/binary_expression.hpp>
+#include <hmpc/expr/crypto/lhe/ciphertext.hpp>
+#include <hmpc/expr/crypto/lhe/enc.hpp>
+#include <hmpc/expr/crypto/lhe/key.hpp>
+#include <hmpc/expr/crypto/lhe/linear_combination.hpp>
+#include <hmpc/expr/crypto/lhe/plaintext.hpp>
+#include <hmpc/expr/crypto/lhe/randomness.hpp>
+#include <hmpc/expr/expression.hpp>
+#include <hmpc/expr/matrix_vector_product.hpp>
+#include <hmpc/expr/number_theoretic_transform.hpp>
+#include <hmpc/expr/random/number_generator.hpp>
+#include <hmpc/expr/random/uniform.hpp>
+#include <hmpc/expr/reduce.hpp>
+#include <hmpc/expr/tensor.hpp>
+#include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/numeric.hpp>
+#include <hmpc/ints/poly.hpp>
+#include <hmpc/random/binomial.hpp>
+#include <hmpc/rational.hpp>
+
+#include <span>
+
+namespace hmpc::expr::crypto::lhe
+{
+    /// # Bounds for proofs of plaintext knowledge
+    /// Exclusive bounds for the absolute values of the (centered) coefficients of honestly generated plaintexts and randomness (see `randomness` with the variances `VarianceU`, `VarianceV`, and `VarianceW`),
+    /// the bounds of the masks (drowning the sum of `BatchSize` such values), and the bounds that the verifier checks for the responses.
+    template<typename Plaintext, typename Poly, hmpc::size BatchSize, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security, hmpc::maybe_rational_size_constant VarianceU = decltype(hmpc::constants::half), hmpc::maybe_rational_size_constant VarianceV = decltype(hmpc::constants::ten), hmpc::maybe_rational_size_constant VarianceW = decltype(hmpc::constants::ten)>
+    struct proof_limits
+    {
+        using element_type = hmpc::traits::element_type_t<Poly>;
+        using plaintext_element_type = hmpc::traits::element_type_t<Plaintext>;
+        using limb_type = element_type::limb_type;
+
+        static_assert(BatchSize > 0);
+        static_assert(hmpc::detail::bit_width(BatchSize) <= limb_type::bit_size);
+        static constexpr auto batch_size = hmpc::ints::ubigint<hmpc::detail::bit_width(BatchSize), limb_type>{static_cast<limb_type::underlying_type>(BatchSize)};
+
+        static constexpr auto plaintext_bound = hmpc::ints::limb_cast<limb_type>(plaintext_element_type::half_modulus) + hmpc::ints::one<limb_type>;
+
+        /// Exclusive bound of `centered_binomial` samples with variance `Variance` (see `hmpc::random::centered_binomial_limits`)
+        template<hmpc::maybe_rational_size_constant Variance>
+        static constexpr auto centered_binomial_bound = []()
+        {
+            constexpr hmpc::size bound = hmpc::random::centered_binomial_limits<hmpc::rational_size{Variance::value}>::mean + 1;
+            return hmpc::ints::num::bit_copy<hmpc::ints::ubigint<hmpc::detail::bit_width(bound), limb_type>>(hmpc::core::size_limb_span<limb_type>(bound));
+        }();
+
+        static constexpr auto u_bound = centered_binomial_bound<VarianceU>;
+        static constexpr auto v_bound = centered_binomial_bound<VarianceV>;
+        static constexpr auto w_bound = centered_binomial_bound<VarianceW>;
+
+        /// Bound for `drown_signed_uniform` of a mask for values with bound `Bound`
+        template<auto Bound>
+        static constexpr auto mask_bound = Bound * batch_size;
+
+        /// |mask| <= 2^bit_width((mask_bound - 1) * 2^security) (see `hmpc::random::drown_uniform`) and |sum| < mask_bound
+        template<auto Bound>
+        static constexpr auto response_bound = []()
+        {
+            constexpr auto drowning_bits = hmpc::ints::bit_width((mask_bound<Bound> - hmpc::ints::one<limb_type>) << hmpc::size_constant_of<static_cast<hmpc::size>(StatisticalSecurity)>);
+            return (hmpc::ints::one<limb_type> << hmpc::size_constant_of<drowning_bits>) + mask_bound<Bound>;
+        }();
+
+        static_assert(response_bound<plaintext_bound> < element_type::half_modulus);
+        static_assert(response_bound<u_bound> < element_type::half_modulus);
+        static_assert(response_bound<v_bound> < element_type::half_modulus);
+        static_assert(response_bound<w_bound> < element_type::half_modulus);
+    };
+
+    /// Checks if all coefficients c of `E` (in coefficient representation) are small, i.e., -Bound < c < Bound.
+    /// The result has the element shape of `E`, i.e., one bit per coefficient.
+    template<auto Bound, hmpc::expression E>
+    struct bounded_expression
+    {
+        using inner_type = E;
+        using inner_value_type = inner_type::value_type;
+        using inner_element_type = hmpc::traits::element_type_t<inner_value_type>;
+        using value_type = hmpc::bit;
+        using element_type = value_type;
+        using shape_type = hmpc::traits::element_shape_t<inner_value_type, typename inner_type::shape_type>;
+        using element_shape_type = shape_type;
+
+        static_assert(inner_value_type::representation == hmpc::ints::coefficient_representation);
+
+        static constexpr auto lower_bound = Bound;
+        static constexpr auto upper_bound = static_cast<inner_element_type::unsigned_type>(inner_element_type::modulus - Bound);
+
+        static constexpr hmpc::size arity = 1;
+
+        inner_type inner;
+
+        constexpr bounded_expression(inner_type const& inner) HMPC_NOEXCEPT
+            : inner(inner)
+        {
+        }
+
+        constexpr inner_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return inner;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::element_shape<inner_value_type>(inner.shape());
+        }
+
+        static constexpr element_type operator()(hmpc::state_with_arity<1> auto const& state, hmpc::mdindex_for<element_shape_type> auto const& index, auto& capabilities) HMPC_NOEXCEPT
+        {
+            auto value = static_cast<inner_element_type::unsigned_type>(inner_type::operator()(state.get(hmpc::constants::zero), index, capabilities));
+            return (value < lower_bound) bitor (value > upper_bound);
+        }
+    };
+
+    template<auto Bound, hmpc::expression E>
+    constexpr auto bounded(E const& e, hmpc::constant<decltype(Bound), Bound> = {}) HMPC_NOEXCEPT
+    {
+        return bounded_expression<Bound, E>{e};
+    }
+
+    /// # Binary challenge matrix
+    /// Every entry is the constant polynomial 0 or 1 (in number theoretic transform representation, i.e., the same value in every slot),
+    /// drawn from the keystream of `Engine` keyed with a seed (e.g., the hash of the transcript).
+    template<typename Poly, hmpc::random::engine Engine, hmpc::size... Dimensions>
+    struct challenge_expression
+    {
+        using value_type = Poly;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using shape_type = hmpc::shape<Dimensions...>;
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        using engine_type = Engine;
+        using generator_type = hmpc::expr::random::number_generator_expression<engine_type>;
+
+        static_assert(value_type::representation == hmpc::ints::number_theoretic_transform_representation);
+
+        static constexpr hmpc::size arity = 0;
+
+        shape_type HMPC_PRIVATE_MEMBER(shape);
+        generator_type number_generator;
+
+        constexpr challenge_expression(generator_type const& number_generator, shape_type shape) HMPC_NOEXCEPT
+            : HMPC_PRIVATE_MEMBER(shape)(shape)
+            , number_generator(number_generator)
+        {
+        }
+
+        constexpr auto state(auto&) const noexcept
+        {
+            // one generator per entry (shared by all slots)
+            return hmpc::expr::random::number_generator_storage{number_generator, shape()};
+        }
+
+        constexpr shape_type const& shape() const noexcept
+        {
+            return HMPC_PRIVATE_MEMBER(shape);
+        }
+
+        static constexpr element_type operator()(hmpc::expr::random::number_generator_storage<engine_type, shape_type> const& number_generator, hmpc::mdindex_for<element_shape_type> auto const& index, auto&) HMPC_DEVICE_NOEXCEPT
+        {
+            auto random = hmpc::iter::for_packed_range<shape_type::rank>([&](auto... i)
+            {
+                return number_generator.generator(hmpc::index{index.get(i)...});
+            });
+
+            hmpc::ints::ubigint<1, typename element_type::limb_type> bit;
+            random.uniform(bit.span(hmpc::access::write));
+            return element_type{bit};
+        }
+    };
+
+    template<typename Poly, hmpc::random::engine Engine = hmpc::default_random_engine, hmpc::size... Dimensions>
+    constexpr auto challenge(hmpc::core::limb_span<Engine::key_size, typename Engine::value_type, hmpc::access::read_tag> seed, hmpc::shape<Dimensions...> shape) HMPC_NOEXCEPT
+    {
+        return challenge_expression<Poly, Engine, Dimensions...>{
+            hmpc::expr::random::number_generator<Engine>(seed, hmpc::index{0}, hmpc::shape{1}),
+            shape
+        };
+    }
+
+    namespace detail
+    {
+        /// Fiat-Shamir: hash of the key, the ciphertexts, and the commitment (see `hmpc::crypto::chacha_sponge`)
+        template<typename Poly, hmpc::size... Dimensions, hmpc::size... CommitmentDimensions>
+        auto proof_challenge_seed(hmpc::comp::crypto::lhe::key<Poly>& key, hmpc::comp::crypto::lhe::ciphertext<Poly, Dimensions...>& ciphertexts, hmpc::comp::crypto::lhe::ciphertext<Poly, CommitmentDimensions...>& commitment)
+        {
+            using sponge_type = hmpc::crypto::chacha_sponge<>;
+            static_assert(sponge_type::digest_size == hmpc::default_random_engine::key_size);
+            static_assert(std::same_as<sponge_type::value_type, hmpc::default_random_engine::value_type>);
+
+            sponge_type sponge;
+
+            auto absorb = [&](auto& tensor)
+            {
+                using limb_type = std::remove_cvref_t<decltype(tensor)>::limb_type;
+
+                hmpc::size limb_count = tensor.get().byte_size() / sizeof(limb_type);
+                // length prefix for an unambiguous encoding
+                sponge.absorb(sponge_type::value_type{static_cast<sponge_type::value_type::underlying_type>(limb_count)});
+                sponge.absorb(sponge_type::value_type{static_cast<sponge_type::value_type::underlying_type>(limb_count >> sponge_type::value_type::bit_size)});
+
+                hmpc::comp::host_accessor access(tensor, hmpc::access::read);
+                sponge.absorb(std::span<limb_type const>(access.data(), limb_count));
+            };
+
+            absorb(key.a);
+            absorb(key.b);
+            absorb(ciphertexts.c0);
+            absorb(ciphertexts.c1);
+            absorb(commitment.c0);
+            absorb(commitment.c1);
+
+            return sponge.digest();
+        }
+    }
+
+    /// # Batched proof of plaintext knowledge (prover)
+    /// Proves knowledge of the plaintexts and randomness of `BatchSize` ciphertexts (encrypted with `enc` and randomness from `randomness`) with `mask_count` encrypted masks.
+    /// The prover commits to masks y (and randomness s) that drown the plaintexts (and randomness), derives a binary challenge matrix W from the hash of the transcript,
+    /// and responds with z = y + W * x (and t = s + W * r), all computed over the ciphertext ring.
+    /// The soundness error is 2^{-mask_count} (binary challenges), so use at least as many masks as bits of security; the cost is amortized over large batches.
+    template<typename Plaintext, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security, typename Queue, typename Poly, hmpc::size BatchSize>
+    auto prove(Queue& queue, hmpc::comp::crypto::lhe::key<Poly>& key, hmpc::comp::tensor<Plaintext, BatchSize>& plaintexts, hmpc::comp::crypto::lhe::randomness<Poly, BatchSize>& randomness, hmpc::comp::crypto::lhe::ciphertext<Poly, BatchSize>& ciphertexts, hmpc::size mask_count)
+    {
+        using namespace hmpc::expr::operators;
+
+        using limits = proof_limits<Plaintext, Poly, BatchSize, StatisticalSecurity>;
+        using coeff_type = hmpc::ints::traits::coefficient_type_t<Poly>;
+        constexpr auto security = hmpc::constant_of<StatisticalSecurity>;
+
+        auto mask_shape = hmpc::shape{mask_count};
+
+        auto [y_hat, s_u_hat, s_v_hat, s_w_hat] = hmpc::expr::batched_number_theoretic_transform(
+            hmpc::expr::random::drown_signed_uniform<coeff_type>(mask_shape, hmpc::constant_of<limits::template mask_bound<limits::plaintext_bound>>, security),
+            hmpc::expr::random::drown_signed_uniform<coeff_type>(mask_shape, hmpc::constant_of<limits::template mask_bound<limits::u_bound>>, security),
+            hmpc::expr::random::drown_signed_uniform<coeff_type>(mask_shape, hmpc::constant_of<limits::template mask_bound<limits::v_bound>>, security),
+            hmpc::expr::random::drown_signed_uniform<coeff_type>(mask_shape, hmpc::constant_of<limits::template mask_bound<limits::w_bound>>, security)
+        );
+        auto [y, s_u, s_v, s_w] = queue(y_hat, s_u_hat, s_v_hat, s_w_hat);
+
+        auto commitment = queue(enc_lifted<Plaintext>(
+            hmpc::expr::crypto::lhe::key(key),
+            hmpc::expr::tensor(y),
+            hmpc::expr::crypto::lhe::randomness(s_u, s_v, s_w)
+        ));
+
+        auto seed = detail::proof_challenge_seed(key, ciphertexts, commitment);
+        auto w = challenge<Poly>(seed.span(hmpc::access::read), hmpc::shape{mask_count, hmpc::size_constant_of<BatchSize>});
+
+        auto r = hmpc::expr::crypto::lhe::randomness(randomness);
+        auto [z, t] = queue(
+            hmpc::expr::matrix_vector_product(w, plaintext<Poly>(hmpc::expr::tensor(plaintexts))) + hmpc::expr::tensor(y),
+            randomness_expression{
+                hmpc::expr::matrix_vector_product(w, r.u) + hmpc::expr::tensor(s_u),
+                hmpc::expr::matrix_vector_product(w, r.v) + hmpc::expr::tensor(s_v),
+                hmpc::expr::matrix_vector_product(w, r.w) + hmpc::expr::tensor(s_w)
+            }
+        );
+
+        return hmpc::comp::crypto::lhe::proof{std::move(commitment), std::move(z), std::move(t)};
+    }
+
+    /// # Batched proof of plaintext knowledge (verifier)
+    /// Recomputes the challenge matrix W and checks enc(z; t) == commitment + W * ciphertexts and the bounds of z and t (see `proof_limits`).
+    template<typename Plaintext, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security, typename Queue, typename Poly, hmpc::size BatchSize, hmpc::size... Dimensions>
+    bool verify(Queue& queue, hmpc::comp::crypto::lhe::key<Poly>& key, hmpc::comp::crypto::lhe::ciphertext<Poly, BatchSize>& ciphertexts, hmpc::comp::crypto::lhe::proof<Poly, Dimensions...>& proof)
+    {
+        using namespace hmpc::expr::operators;
+
+        using limits = proof_limits<Plaintext, Poly, BatchSize, StatisticalSecurity>;
+
+        auto mask_count = proof.z.shape().get(hmpc::constants::zero);
+
+        auto seed = detail::proof_challenge_seed(key, ciphertexts, proof.commitment);
+        auto w = challenge<Poly>(seed.span(hmpc::access::read), hmpc::shape{mask_count, hmpc::size_constant_of<BatchSize>});
+
+        auto t = hmpc::expr::crypto::lhe::randomness(proof.t);
+
+        auto [relation, z_bounded, u_bounded, v_bounded, w_bounded] = queue(
+            hmpc::expr::all(
+                enc_lifted<Plaintext>(hmpc::expr::crypto::lhe::key(key), hmpc::expr::tensor(proof.z), t)
+                == hmpc::expr::crypto::lhe::ciphertext(proof.commitment) + hmpc::expr::crypto::lhe::matrix_vector_product(w, hmpc::expr::crypto::lhe::ciphertext(ciphertexts))
+            ),
+            hmpc::expr::all(bounded<limits::template response_bound<limits::plaintext_bound>>(hmpc::expr::inverse_number_theoretic_transform(hmpc::expr::tensor(proof.z)))),
+            hmpc::expr::all(bounded<limits::template response_bound<limits::u_bound>>(hmpc::expr::inverse_number_theoretic_transform(t.u))),
+            hmpc::expr::all(bounded<limits::template response_bound<limits::v_bound>>(hmpc::expr::inverse_number_theoretic_transform(t.v))),
+            hmpc::expr::all(bounded<limits::template response_bound<limits::w_bound>>(hmpc::expr::inverse_number_theoretic_transform(t.w)))
+        );
+
+        auto check = [](auto& result)
+        {
+            hmpc::comp::host_accessor access(result, hmpc::access::read);
+            hmpc::bit value = access;
+            return hmpc::bool_cast(value);
+        };
+
+        return check(relation) and check(z_bounded) and check(u_bounded) and check(v_bounded) and check(w_bounded);
+    }
+}
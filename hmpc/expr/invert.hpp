@@ -0,0 +1,188 @@
+#pragma once
+
+#include <hmpc/comp/accessor.hpp>
+#include <hmpc/detail/utility.hpp>
+#include <hmpc/expr/cache.hpp>
+#include <hmpc/expr/expression.hpp>
+#include <hmpc/ints/integer_traits.hpp>
+#include <hmpc/ints/num/select.hpp>
+
+#include <array>
+
+namespace hmpc::expr
+{
+    template<hmpc::expression E>
+    struct invert_expression
+    {
+        using inner_type = E;
+        using value_type = decltype(invert(std::declval<typename E::value_type>()));
+
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using shape_type = inner_type::shape_type;
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        static constexpr hmpc::size arity = 1;
+
+        inner_type inner;
+
+        constexpr invert_expression(inner_type const& inner) noexcept
+            : inner(inner)
+        {
+        }
+
+        constexpr inner_type const& get(hmpc::size_constant<0>) const noexcept
+        {
+            return inner;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const noexcept
+        {
+            return inner.shape();
+        }
+
+        static constexpr element_type operator()(hmpc::state_with_arity<1> auto const& state, hmpc::index_for<element_shape_type> auto const& index, auto& capabilities) noexcept
+        {
+            return invert(inner_type::operator()(state.get(hmpc::constants::zero), index, capabilities));
+        }
+    };
+
+    /// Element-wise modular inverse (see `hmpc::ints::mod::invert`)
+    /// The kernel computes pow(x, modulus - 2), so the modulus must be prime; for other moduli, the result is not the inverse (even for invertible x).
+    template<hmpc::expression E>
+    constexpr auto invert(E e)
+    {
+        return invert_expression<E>{e};
+    }
+
+    /// # Batched inversion (Montgomery's trick)
+    /// Every work item inverts `BatchSize` consecutive elements x_0, ..., x_{n-1} with a single inversion:
+    /// 1. Compute the prefix products p_j = x_0 * ... * x_{j-1}.
+    /// 2. Invert the full product: y = (x_0 * ... * x_{n-1})^{-1}.
+    /// 3. For j = n-1, ..., 0: x_j^{-1} = y * p_j and y = y * x_j.
+    /// This needs three multiplications per element.
+    /// Zero elements are replaced by one for the product and are mapped to zero (like `invert`).
+    /// Like `invert`, this requires a prime modulus.
+    template<hmpc::expression E, hmpc::size BatchSize>
+    struct batch_invert_expression : public enable_caching
+    {
+        using enable_caching::operator();
+
+        using inner_type = E;
+        using value_type = inner_type::value_type;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using limb_type = hmpc::traits::limb_type_t<value_type>;
+        using shape_type = inner_type::shape_type;
+
+        static_assert(std::same_as<value_type, element_type>);
+        static_assert(BatchSize > 0);
+        static constexpr hmpc::size batch_size = BatchSize;
+
+        static constexpr hmpc::size arity = 1;
+        using is_complex = void;
+
+        inner_type inner;
+
+        constexpr batch_invert_expression(inner_type inner) noexcept
+            : inner(inner)
+        {
+        }
+
+        constexpr inner_type const& get(hmpc::size_constant<0>) const noexcept
+        {
+            return inner;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const noexcept
+        {
+            return inner.shape();
+        }
+
+        constexpr auto operator()(auto& sycl_queue, auto& get_state, auto& get_capability_data, auto& make_capabilities, auto& tensor, auto&) const HMPC_NOEXCEPT
+        {
+            return sycl_queue.submit([&](auto& handler)
+            {
+                auto state = get_state(handler).get(hmpc::constants::zero);
+                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                auto element_shape = hmpc::expr::element_shape(inner);
+                auto capability_data = get_capability_data(element_shape);
+                auto element_count = element_shape.size();
+                auto batch_count = hmpc::detail::div_ceil(element_count, batch_size);
+
+                handler.parallel_for(sycl::range{batch_count}, [=](hmpc::size b)
+                {
+                    constexpr auto zero = hmpc::ints::integer_traits<element_type>::zero;
+                    constexpr auto one = hmpc::ints::integer_traits<element_type>::one;
+
+                    std::array<element_type, batch_size> values;
+                    std::array<element_type, batch_size> prefix;
+                    std::array<hmpc::bit, batch_size> is_zero;
+
+                    auto product = one;
+                    hmpc::iter::for_range<batch_size>([&](auto j)
+                    {
+                        auto i = b * batch_size + j;
+
+                        auto value = one;
+                        if (i < element_count) // batches might be too big -> use one if out of allowed range
+                        {
+                            auto index = [&]()
+                            {
+                                if constexpr (hmpc::expr::same_element_shape<inner_type>)
+                                {
+                                    return i;
+                                }
+                                else
+                                {
+                                    return hmpc::from_linear_index(i, element_shape);
+                                }
+                            }();
+
+                            auto capabilities = make_capabilities(capability_data, index, element_shape);
+
+                            value = inner_type::operator()(state, index, capabilities);
+                        }
+
+                        is_zero[j] = (value == zero);
+                        hmpc::ints::num::select(values[j], value, one, is_zero[j]);
+                        prefix[j] = product;
+                        product *= values[j];
+                    });
+
+                    auto inverse = invert(product);
+
+                    hmpc::iter::for_range<batch_size>([&](auto k)
+                    {
+                        constexpr auto j = hmpc::size_constant_of<batch_size - 1 - k>;
+                        auto i = b * batch_size + j;
+
+                        // inverse == (values[0] * ... * values[j])^{-1}
+                        auto result = inverse * prefix[j];
+                        inverse *= values[j];
+
+                        if (i < element_count)
+                        {
+                            hmpc::ints::num::select(result, result, zero, is_zero[j]);
+                            write[i] = result;
+                        }
+                    });
+                });
+            });
+        }
+    };
+
+    template<hmpc::size BatchSize = 16, hmpc::expression E>
+    constexpr auto batch_invert(E expression) noexcept
+    {
+        return batch_invert_expression<E, BatchSize>{expression};
+    }
+}
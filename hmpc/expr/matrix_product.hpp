@@ -1,6 +1,13 @@
 #pragma once
 
+#include <hmpc/comp/accessor.hpp>
+#include <hmpc/detail/utility.hpp>
 #include <hmpc/expr/binary_expression.hpp>
+#include <hmpc/expr/cache.hpp>
+#include <hmpc/expr/contraction.hpp>
+#include <hmpc/ints/mod.hpp>
+
+#include <sycl/sycl.hpp>
 
 namespace hmpc::expr
 {
@@ -35,16 +42,8 @@ namespace hmpc::expr
         static constexpr hmpc::size right_rank = right_shape_type::rank;
         static_assert(left_rank == right_rank);
         static_assert(left_rank >= 2);
-        static constexpr hmpc::size sum_extent = []()
-        {
-            constexpr auto u_index = hmpc::size_constant_of<left_rank - 2>;
-            constexpr auto v_index = hmpc::size_constant_of<right_rank - 1>;
-            constexpr auto extent = left_shape_type::extent(v_index);
-            static_assert(extent == right_shape_type::extent(u_index));
-            static_assert(extent != hmpc::placeholder_extent);
-            static_assert(extent != hmpc::dynamic_extent);
-            return extent;
-        }();
+        static constexpr hmpc::size sum_extent = detail::contraction_extent<left_shape_type, left_rank - 1, right_shape_type, right_rank - 2>;
+        static_assert(sum_extent != hmpc::dynamic_extent);
 
         using left_value_type = left_type::value_type;
         using right_value_type = right_type::value_type;
@@ -52,6 +51,9 @@ namespace hmpc::expr
         using value_type = std::remove_cvref_t<typename decltype(hmpc::iter::for_packed_range<sum_extent>([](auto... i){ using T = decltype(((static_cast<void>(i), std::declval<multiply_type>()) + ...)); return hmpc::detail::tag_of<T>; }))::type>;
         using element_type = hmpc::traits::element_type_t<value_type>;
 
+        /// Sum products without intermediate reduction (see `hmpc::ints::traits::product_accumulator`)
+        static constexpr bool use_product_accumulator = std::same_as<left_value_type, value_type> and std::same_as<right_value_type, value_type> and not multiply_is_specialized<left_value_type, right_value_type> and hmpc::ints::has_product_accumulator<value_type, sum_extent>;
+
         static constexpr hmpc::size arity = 2;
 
         left_type left;
@@ -61,6 +63,7 @@ namespace hmpc::expr
             : left(left)
             , right(right)
         {
+            HMPC_HOST_ASSERT(left.shape().get(hmpc::size_constant_of<left_rank - 1>) == right.shape().get(hmpc::size_constant_of<right_rank - 2>));
         }
 
         constexpr left_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
@@ -94,51 +97,451 @@ namespace hmpc::expr
         template<hmpc::index_for<element_shape_type> Index>
         static constexpr element_type operator()(hmpc::state_with_arity<2> auto const& state, Index const& index, auto& capabilities) HMPC_NOEXCEPT
         {
-            return hmpc::iter::for_packed_range<sum_extent>([&](auto... k)
+            constexpr auto index_rank = Index::rank;
+            auto left_index = [&](auto k)
             {
-                return ([&]()
+                return hmpc::iter::for_packed_range<left_rank - 1>([&](auto... i)
                 {
-                    constexpr auto index_rank = Index::rank;
-                    auto left_index = hmpc::iter::for_packed_range<left_rank - 1>([&](auto... i)
+                    return hmpc::iter::for_packed_range<left_rank, index_rank>([&](auto... j)
                     {
-                        return hmpc::iter::for_packed_range<left_rank, index_rank>([&](auto... j)
-                        {
-                            return hmpc::index{index.get(i)..., k, index.get(j)...};
-                        });
+                        return hmpc::index{index.get(i)..., k, index.get(j)...};
+                    });
+                });
+            };
+
+            auto right_index = [&](auto k)
+            {
+                return hmpc::iter::for_packed_range<right_rank - 2>([&](auto... i)
+                {
+                    return hmpc::iter::for_packed_range<right_rank - 1, index_rank>([&](auto... j)
+                    {
+                        return hmpc::index{index.get(i)..., k, index.get(j)...};
                     });
+                });
+            };
 
-                    auto right_index = hmpc::iter::for_packed_range<right_rank - 2>([&](auto... i)
+            if constexpr (use_product_accumulator)
+            {
+                hmpc::ints::traits::product_accumulator_t<value_type, sum_extent> accumulator;
+                hmpc::iter::for_range<sum_extent>([&](auto k)
+                {
+                    accumulator.multiply_add(
+                        left_type::operator()(state.get(hmpc::constants::zero), left_index(k), capabilities),
+                        right_type::operator()(state.get(hmpc::constants::one), right_index(k), capabilities)
+                    );
+                });
+                return accumulator.reduce();
+            }
+            else
+            {
+                return hmpc::iter::for_packed_range<sum_extent>([&](auto... k)
+                {
+                    return ([&]()
                     {
-                        return hmpc::iter::for_packed_range<right_rank - 1, index_rank>([&](auto... j)
+                        if constexpr (multiply_is_specialized<left_value_type, right_value_type>)
+                        {
+                            return traits::multiply_specialization<left_value_type, right_value_type>::operator()(
+                                hmpc::detail::tag_of<left_type>,
+                                state.get(hmpc::constants::zero),
+                                left_index(k),
+                                hmpc::detail::tag_of<right_type>,
+                                state.get(hmpc::constants::one),
+                                right_index(k),
+                                capabilities
+                            );
+                        }
+                        else
                         {
-                            return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            return left_type::operator()(state.get(hmpc::constants::zero), left_index(k), capabilities) * right_type::operator()(state.get(hmpc::constants::one), right_index(k), capabilities);
+                        }
+                    }() + ...);
+                });
+            }
+        }
+    };
+
+    /// Edge length of the (square) output tiles of `tiled_matrix_product_expression`
+    constexpr hmpc::size default_matrix_product_tile_size = 16;
+
+    /// # Tiled matrix product
+    /// Computes the same result as `matrix_product_expression` (for value types that are their own element type and closed under addition, e.g., `mod`) in one kernel.
+    /// Every work group computes one `TileSize` x `TileSize` tile of the output: it stages matching tiles of `left` and `right` in local memory
+    /// and every work item accumulates its output element from local memory with lazy reduction (see `hmpc::ints::traits::product_accumulator`).
+    /// Hence, every operand element is read from global memory once per work group instead of once per output element.
+    /// The tiles along the summed dimension are iterated in a runtime loop, so this dimension can also be dynamic.
+    template<hmpc::expression Left, hmpc::expression Right, hmpc::size TileSize = default_matrix_product_tile_size>
+    struct tiled_matrix_product_expression : public enable_caching
+    {
+        using enable_caching::operator();
+
+        using left_type = Left;
+        using right_type = Right;
+
+        using left_shape_type = left_type::shape_type;
+        using right_shape_type = right_type::shape_type;
+
+        static constexpr hmpc::size rank = left_shape_type::rank;
+        static_assert(rank == right_shape_type::rank);
+        static_assert(rank >= 2);
+        /// Can be `hmpc::dynamic_extent`
+        static constexpr hmpc::size sum_extent = detail::contraction_extent<left_shape_type, rank - 1, right_shape_type, rank - 2>;
+
+        static constexpr hmpc::size tile_size = TileSize;
+        static_assert(tile_size > 0);
+
+        using value_type = left_type::value_type;
+        using element_type = value_type;
+        static_assert(std::same_as<typename right_type::value_type, value_type>);
+        static_assert(std::same_as<hmpc::traits::element_type_t<value_type>, value_type>);
+
+        /// The last tile along the sum dimension is padded with zeros, so a static sum dimension accumulates a whole number of tiles without intermediate reduction (if possible)
+        static constexpr bool accumulate_all_tiles = []()
+        {
+            if constexpr (sum_extent == hmpc::dynamic_extent)
+            {
+                return false;
+            }
+            else
+            {
+                return hmpc::ints::has_product_accumulator<element_type, hmpc::detail::div_ceil(sum_extent, tile_size) * tile_size>;
+            }
+        }();
+        /// Otherwise, reduce once per tile
+        static constexpr bool accumulate_each_tile = not accumulate_all_tiles and hmpc::ints::has_product_accumulator<element_type, tile_size>;
+
+        using shape_type = decltype(matrix_product_shape(std::declval<left_shape_type>(), std::declval<right_shape_type>()));
+
+        static constexpr hmpc::size arity = 2;
+        using is_complex = void;
+
+        left_type left;
+        right_type right;
+
+        constexpr tiled_matrix_product_expression(left_type left, right_type right) HMPC_NOEXCEPT
+            : left(left)
+            , right(right)
+        {
+            HMPC_HOST_ASSERT(left.shape().get(hmpc::size_constant_of<rank - 1>) == right.shape().get(hmpc::size_constant_of<rank - 2>));
+        }
+
+        constexpr left_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return left;
+        }
+
+        constexpr right_type const& get(hmpc::size_constant<1>) const HMPC_NOEXCEPT
+        {
+            return right;
+        }
+
+        static constexpr hmpc::access::multiple_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        static constexpr hmpc::access::multiple_tag access(hmpc::size_constant<1>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return matrix_product_shape(left.shape(), right.shape());
+        }
+
+        constexpr auto operator()(auto& sycl_queue, auto& get_state, auto& get_capability_data, auto& make_capabilities, auto& tensor, auto&) const HMPC_NOEXCEPT
+        {
+            return sycl_queue.submit([&](auto& handler)
+            {
+                auto state = get_state(handler);
+                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                auto shape = this->shape();
+                auto capability_data = get_capability_data(shape);
+
+                hmpc::size extent = left.shape().get(hmpc::size_constant_of<rank - 1>);
+                hmpc::size tile_count = hmpc::detail::div_ceil(extent, tile_size);
+                hmpc::size rows = shape.get(hmpc::size_constant_of<rank - 2>);
+                hmpc::size columns = shape.get(hmpc::size_constant_of<rank - 1>);
+                hmpc::size batch_count = hmpc::iter::for_packed_range<rank - 2>([&](auto... i)
+                {
+                    return (hmpc::size{1} * ... * static_cast<hmpc::size>(shape.get(i)));
+                });
+
+                sycl::local_accessor<element_type, 2> left_tile(sycl::range<2>{tile_size, tile_size}, handler);
+                sycl::local_accessor<element_type, 2> right_tile(sycl::range<2>{tile_size, tile_size}, handler);
+
+                sycl::range<3> global_range{batch_count, hmpc::detail::div_ceil(rows, tile_size) * tile_size, hmpc::detail::div_ceil(columns, tile_size) * tile_size};
+                sycl::range<3> local_range{1, tile_size, tile_size};
+
+                handler.parallel_for(sycl::nd_range<3>{global_range, local_range}, [=](sycl::nd_item<3> item)
+                {
+                    hmpc::size batch = item.get_global_id(0);
+                    hmpc::size row = item.get_global_id(1);
+                    hmpc::size column = item.get_global_id(2);
+                    hmpc::size local_row = item.get_local_id(1);
+                    hmpc::size local_column = item.get_local_id(2);
+                    bool in_range = row < rows and column < columns;
+
+                    // work items outside of the output still help to load the tiles
+                    auto batch_index = hmpc::from_linear_index(batch * rows * columns, shape);
+                    auto index = [&](hmpc::size i, hmpc::size j)
+                    {
+                        return hmpc::iter::for_packed_range<rank - 2>([&](auto... b)
+                        {
+                            return hmpc::index{batch_index.get(b)..., i, j};
                         });
-                    });
+                    };
+                    auto capabilities = make_capabilities(capability_data, index(in_range ? row : 0, in_range ? column : 0), shape);
+
+                    auto sum = []()
+                    {
+                        if constexpr (accumulate_all_tiles)
+                        {
+                            return hmpc::ints::traits::product_accumulator_t<element_type, hmpc::detail::div_ceil(sum_extent, tile_size) * tile_size>{};
+                        }
+                        else
+                        {
+                            return element_type{};
+                        }
+                    }();
 
-                    if constexpr (multiply_is_specialized<left_value_type, right_value_type>)
+                    for (hmpc::size t = 0; t < tile_count; ++t)
                     {
-                        return traits::multiply_specialization<left_value_type, right_value_type>::operator()(
-                            hmpc::detail::tag_of<left_type>,
-                            state.get(hmpc::constants::zero),
-                            left_index,
-                            hmpc::detail::tag_of<right_type>,
-                            state.get(hmpc::constants::one),
-                            right_index,
-                            capabilities
-                        );
+                        hmpc::size left_column = t * tile_size + local_column;
+                        hmpc::size right_row = t * tile_size + local_row;
+
+                        if (row < rows and left_column < extent)
+                        {
+                            left_tile[local_row][local_column] = left_type::operator()(state.get(hmpc::constants::zero), index(row, left_column), capabilities);
+                        }
+                        else
+                        {
+                            left_tile[local_row][local_column] = element_type{};
+                        }
+
+                        if (right_row < extent and column < columns)
+                        {
+                            right_tile[local_row][local_column] = right_type::operator()(state.get(hmpc::constants::one), index(right_row, column), capabilities);
+                        }
+                        else
+                        {
+                            right_tile[local_row][local_column] = element_type{};
+                        }
+
+                        sycl::group_barrier(item.get_group());
+
+                        if constexpr (accumulate_all_tiles)
+                        {
+                            hmpc::iter::for_range<tile_size>([&](auto k)
+                            {
+                                sum.multiply_add(left_tile[local_row][k], right_tile[k][local_column]);
+                            });
+                        }
+                        else if constexpr (accumulate_each_tile)
+                        {
+                            hmpc::ints::traits::product_accumulator_t<element_type, tile_size> tile_sum;
+                            hmpc::iter::for_range<tile_size>([&](auto k)
+                            {
+                                tile_sum.multiply_add(left_tile[local_row][k], right_tile[k][local_column]);
+                            });
+                            sum += tile_sum.reduce();
+                        }
+                        else
+                        {
+                            hmpc::iter::for_range<tile_size>([&](auto k)
+                            {
+                                sum += left_tile[local_row][k] * right_tile[k][local_column];
+                            });
+                        }
+
+                        // all work items have to be done with the tiles before they are overwritten
+                        sycl::group_barrier(item.get_group());
                     }
-                    else
+
+                    if (in_range)
                     {
-                        return left_type::operator()(state.get(hmpc::constants::zero), left_index, capabilities) * right_type::operator()(state.get(hmpc::constants::one), right_index, capabilities);
+                        auto id = (batch * rows + row) * columns + column;
+                        if constexpr (accumulate_all_tiles)
+                        {
+                            write[id] = sum.reduce();
+                        }
+                        else
+                        {
+                            write[id] = sum;
+                        }
                     }
-                }() + ...);
+                });
             });
         }
     };
 
+    /// # Matrix product with a runtime loop
+    /// Computes the same result as `matrix_product_expression` if the summed dimension is only known at runtime (or too large to unroll) and the value type is not supported by `tiled_matrix_product_expression` (e.g., polynomials).
+    /// The sum runs in a runtime loop that accumulates blocks of `contraction_block_size` products lazily (see `detail::blocked_sum_of_products`).
     template<hmpc::expression Left, hmpc::expression Right>
+    struct blocked_matrix_product_expression : public enable_caching
+    {
+        using enable_caching::operator();
+
+        using left_type = Left;
+        using right_type = Right;
+
+        using left_shape_type = left_type::shape_type;
+        using right_shape_type = right_type::shape_type;
+
+        static constexpr hmpc::size rank = left_shape_type::rank;
+        static_assert(rank == right_shape_type::rank);
+        static_assert(rank >= 2);
+        static constexpr hmpc::size sum_extent = detail::contraction_extent<left_shape_type, rank - 1, right_shape_type, rank - 2>;
+
+        using left_value_type = left_type::value_type;
+        using right_value_type = right_type::value_type;
+        static_assert(detail::closed_contraction<left_value_type, right_value_type>);
+        using value_type = std::remove_cvref_t<decltype(std::declval<left_value_type>() * std::declval<right_value_type>())>;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+
+        /// Sum products without intermediate reduction within each block (see `hmpc::ints::traits::product_accumulator`)
+        static constexpr bool use_product_accumulator = std::same_as<left_value_type, value_type> and std::same_as<right_value_type, value_type> and not multiply_is_specialized<left_value_type, right_value_type> and hmpc::ints::has_product_accumulator<element_type, contraction_block_size>;
+
+        using shape_type = decltype(matrix_product_shape(std::declval<left_shape_type>(), std::declval<right_shape_type>()));
+
+        static constexpr hmpc::size arity = 2;
+        using is_complex = void;
+
+        left_type left;
+        right_type right;
+
+        constexpr blocked_matrix_product_expression(left_type left, right_type right) HMPC_NOEXCEPT
+            : left(left)
+            , right(right)
+        {
+            HMPC_HOST_ASSERT(left.shape().get(hmpc::size_constant_of<rank - 1>) == right.shape().get(hmpc::size_constant_of<rank - 2>));
+        }
+
+        constexpr left_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return left;
+        }
+
+        constexpr right_type const& get(hmpc::size_constant<1>) const HMPC_NOEXCEPT
+        {
+            return right;
+        }
+
+        static constexpr hmpc::access::multiple_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        static constexpr hmpc::access::multiple_tag access(hmpc::size_constant<1>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return matrix_product_shape(left.shape(), right.shape());
+        }
+
+        constexpr auto operator()(auto& sycl_queue, auto& get_state, auto& get_capability_data, auto& make_capabilities, auto& tensor, auto&) const HMPC_NOEXCEPT
+        {
+            return sycl_queue.submit([&](auto& handler)
+            {
+                auto state = get_state(handler);
+                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                auto element_shape = hmpc::element_shape<value_type>(shape());
+                auto capability_data = get_capability_data(element_shape);
+                hmpc::size extent = left.shape().get(hmpc::size_constant_of<rank - 1>);
+
+                handler.parallel_for(sycl::range{element_shape.size()}, [=](hmpc::size id)
+                {
+                    auto index = hmpc::from_linear_index(id, element_shape);
+                    constexpr auto index_rank = decltype(index)::rank;
+                    auto capabilities = make_capabilities(capability_data, index, element_shape);
+
+                    auto left_index = [&](hmpc::size k)
+                    {
+                        return hmpc::iter::for_packed_range<rank - 1>([&](auto... i)
+                        {
+                            return hmpc::iter::for_packed_range<rank, index_rank>([&](auto... j)
+                            {
+                                return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            });
+                        });
+                    };
+
+                    auto right_index = [&](hmpc::size k)
+                    {
+                        return hmpc::iter::for_packed_range<rank - 2>([&](auto... i)
+                        {
+                            return hmpc::iter::for_packed_range<rank - 1, index_rank>([&](auto... j)
+                            {
+                                return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            });
+                        });
+                    };
+
+                    auto left_element = [&](hmpc::size k)
+                    {
+                        return left_type::operator()(state.get(hmpc::constants::zero), left_index(k), capabilities);
+                    };
+
+                    auto right_element = [&](hmpc::size k)
+                    {
+                        return right_type::operator()(state.get(hmpc::constants::one), right_index(k), capabilities);
+                    };
+
+                    auto product = [&](hmpc::size k) -> element_type
+                    {
+                        if constexpr (multiply_is_specialized<left_value_type, right_value_type>)
+                        {
+                            return traits::multiply_specialization<left_value_type, right_value_type>::operator()(
+                                hmpc::detail::tag_of<left_type>,
+                                state.get(hmpc::constants::zero),
+                                left_index(k),
+                                hmpc::detail::tag_of<right_type>,
+                                state.get(hmpc::constants::one),
+                                right_index(k),
+                                capabilities
+                            );
+                        }
+                        else
+                        {
+                            return left_element(k) * right_element(k);
+                        }
+                    };
+
+                    write[id] = detail::blocked_sum_of_products<element_type, use_product_accumulator>(extent, left_element, right_element, product);
+                });
+            });
+        }
+    };
+
+    /// Matrix product over the last two dimensions of `left` and `right` (and broadcasting over all other dimensions).
+    /// Uses
+    /// - `tiled_matrix_product_expression` (with tiles of `TileSize` x `TileSize` elements) if the value type supports it,
+    /// - `blocked_matrix_product_expression` if the summed dimension is dynamic or larger than `max_unrolled_contraction_extent`, and
+    /// - `matrix_product_expression` otherwise.
+    template<hmpc::size TileSize = default_matrix_product_tile_size, hmpc::expression Left, hmpc::expression Right>
     constexpr auto matrix_product(Left left, Right right) HMPC_NOEXCEPT
     {
-        return matrix_product_expression<Left, Right>{left, right};
+        using left_value_type = Left::value_type;
+        using right_value_type = Right::value_type;
+        using left_shape_type = Left::shape_type;
+        using right_shape_type = Right::shape_type;
+        constexpr auto sum_extent = detail::contraction_extent<left_shape_type, left_shape_type::rank - 1, right_shape_type, right_shape_type::rank - 2>;
+
+        if constexpr (detail::closed_contraction<left_value_type, right_value_type> and std::same_as<left_value_type, right_value_type> and std::same_as<left_value_type, std::remove_cvref_t<decltype(std::declval<left_value_type>() * std::declval<right_value_type>())>> and std::same_as<hmpc::traits::element_type_t<left_value_type>, left_value_type> and not multiply_is_specialized<left_value_type, right_value_type>)
+        {
+            return tiled_matrix_product_expression<Left, Right, TileSize>{left, right};
+        }
+        else if constexpr (detail::use_contraction_loop<sum_extent> and detail::closed_contraction<left_value_type, right_value_type>)
+        {
+            return blocked_matrix_product_expression<Left, Right>{left, right};
+        }
+        else
+        {
+            return matrix_product_expression<Left, Right>{left, right};
+        }
     }
 }
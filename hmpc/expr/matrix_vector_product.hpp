@@ -1,6 +1,10 @@
 #pragma once
 
+#include <hmpc/comp/accessor.hpp>
 #include <hmpc/expr/binary_expression.hpp>
+#include <hmpc/expr/cache.hpp>
+#include <hmpc/expr/contraction.hpp>
+#include <hmpc/ints/mod.hpp>
 
 namespace hmpc::expr
 {
@@ -36,16 +40,8 @@ namespace hmpc::expr
         static constexpr hmpc::size vector_rank = vector_shape_type::rank;
         static_assert(matrix_rank == vector_rank + 1);
         static_assert(matrix_rank >= 2);
-        static constexpr hmpc::size sum_extent = []()
-        {
-            constexpr auto u_index = hmpc::size_constant_of<matrix_rank - 2>;
-            constexpr auto v_index = hmpc::size_constant_of<matrix_rank - 1>;
-            constexpr auto extent = matrix_shape_type::extent(v_index);
-            static_assert(extent == vector_shape_type::extent(u_index));
-            static_assert(extent != hmpc::placeholder_extent);
-            static_assert(extent != hmpc::dynamic_extent);
-            return extent;
-        }();
+        static constexpr hmpc::size sum_extent = detail::contraction_extent<matrix_shape_type, matrix_rank - 1, vector_shape_type, vector_rank - 1>;
+        static_assert(sum_extent != hmpc::dynamic_extent);
 
         using matrix_value_type = matrix_type::value_type;
         using vector_value_type = vector_type::value_type;
@@ -53,6 +49,9 @@ namespace hmpc::expr
         using value_type = std::remove_cvref_t<typename decltype(hmpc::iter::for_packed_range<sum_extent>([](auto... i){ using T = decltype(((static_cast<void>(i), std::declval<multiply_type>()) + ...)); return hmpc::detail::tag_of<T>; }))::type>;
         using element_type = hmpc::traits::element_type_t<value_type>;
 
+        /// Sum products without intermediate reduction (see `hmpc::ints::traits::product_accumulator`)
+        static constexpr bool use_product_accumulator = std::same_as<matrix_value_type, value_type> and std::same_as<vector_value_type, value_type> and not multiply_is_specialized<matrix_value_type, vector_value_type> and hmpc::ints::has_product_accumulator<value_type, sum_extent>;
+
         static constexpr hmpc::size arity = 2;
 
         matrix_type matrix;
@@ -62,6 +61,7 @@ namespace hmpc::expr
             : matrix(matrix)
             , vector(vector)
         {
+            HMPC_HOST_ASSERT(matrix.shape().get(hmpc::size_constant_of<matrix_rank - 1>) == vector.shape().get(hmpc::size_constant_of<vector_rank - 1>));
         }
 
         constexpr matrix_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
@@ -95,51 +95,229 @@ namespace hmpc::expr
         template<hmpc::index_for<element_shape_type> Index>
         static constexpr element_type operator()(hmpc::state_with_arity<2> auto const& state, Index const& index, auto& capabilities) HMPC_NOEXCEPT
         {
-            return hmpc::iter::for_packed_range<sum_extent>([&](auto... k)
+            constexpr auto index_rank = Index::rank;
+            auto matrix_index = [&](auto k)
+            {
+                return hmpc::iter::for_packed_range<matrix_rank - 1>([&](auto... i)
+                {
+                    return hmpc::iter::for_packed_range<matrix_rank - 1, index_rank>([&](auto... j)
+                    {
+                        return hmpc::index{index.get(i)..., k, index.get(j)...};
+                    });
+                });
+            };
+
+            auto vector_index = [&](auto k)
+            {
+                return hmpc::iter::for_packed_range<vector_rank - 1>([&](auto... i)
+                {
+                    return hmpc::iter::for_packed_range<vector_rank, index_rank>([&](auto... j)
+                    {
+                        return hmpc::index{index.get(i)..., k, index.get(j)...};
+                    });
+                });
+            };
+
+            if constexpr (use_product_accumulator)
+            {
+                hmpc::ints::traits::product_accumulator_t<value_type, sum_extent> accumulator;
+                hmpc::iter::for_range<sum_extent>([&](auto k)
+                {
+                    accumulator.multiply_add(
+                        matrix_type::operator()(state.get(hmpc::constants::zero), matrix_index(k), capabilities),
+                        vector_type::operator()(state.get(hmpc::constants::one), vector_index(k), capabilities)
+                    );
+                });
+                return accumulator.reduce();
+            }
+            else
+            {
+                return hmpc::iter::for_packed_range<sum_extent>([&](auto... k)
+                {
+                    return ([&]()
+                    {
+                        if constexpr (multiply_is_specialized<matrix_value_type, vector_value_type>)
+                        {
+                            return traits::multiply_specialization<matrix_value_type, vector_value_type>::operator()(
+                                hmpc::detail::tag_of<matrix_type>,
+                                state.get(hmpc::constants::zero),
+                                matrix_index(k),
+                                hmpc::detail::tag_of<vector_type>,
+                                state.get(hmpc::constants::one),
+                                vector_index(k),
+                                capabilities
+                            );
+                        }
+                        else
+                        {
+                            return matrix_type::operator()(state.get(hmpc::constants::zero), matrix_index(k), capabilities) * vector_type::operator()(state.get(hmpc::constants::one), vector_index(k), capabilities);
+                        }
+                    }() + ...);
+                });
+            }
+        }
+    };
+
+    /// # Matrix-vector product with a runtime loop
+    /// Computes the same result as `matrix_vector_product_expression` if the summed dimension is only known at runtime (or too large to unroll).
+    /// The sum runs in a runtime loop that accumulates blocks of `contraction_block_size` products lazily (see `detail::blocked_sum_of_products`).
+    /// The type of the sum cannot depend on the number of terms, i.e., this requires `detail::closed_contraction`.
+    template<hmpc::expression Matrix, hmpc::expression Vector>
+    struct blocked_matrix_vector_product_expression : public enable_caching
+    {
+        using enable_caching::operator();
+
+        using matrix_type = Matrix;
+        using vector_type = Vector;
+
+        using matrix_shape_type = matrix_type::shape_type;
+        using vector_shape_type = vector_type::shape_type;
+
+        static constexpr hmpc::size matrix_rank = matrix_shape_type::rank;
+        static constexpr hmpc::size vector_rank = vector_shape_type::rank;
+        static_assert(matrix_rank == vector_rank + 1);
+        static_assert(matrix_rank >= 2);
+        static constexpr hmpc::size sum_extent = detail::contraction_extent<matrix_shape_type, matrix_rank - 1, vector_shape_type, vector_rank - 1>;
+
+        using matrix_value_type = matrix_type::value_type;
+        using vector_value_type = vector_type::value_type;
+        static_assert(detail::closed_contraction<matrix_value_type, vector_value_type>);
+        using value_type = std::remove_cvref_t<decltype(std::declval<matrix_value_type>() * std::declval<vector_value_type>())>;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+
+        /// Sum products without intermediate reduction within each block (see `hmpc::ints::traits::product_accumulator`)
+        static constexpr bool use_product_accumulator = std::same_as<matrix_value_type, value_type> and std::same_as<vector_value_type, value_type> and not multiply_is_specialized<matrix_value_type, vector_value_type> and hmpc::ints::has_product_accumulator<element_type, contraction_block_size>;
+
+        using shape_type = decltype(matrix_vector_product_shape(std::declval<matrix_shape_type>(), std::declval<vector_shape_type>()));
+
+        static constexpr hmpc::size arity = 2;
+        using is_complex = void;
+
+        matrix_type matrix;
+        vector_type vector;
+
+        constexpr blocked_matrix_vector_product_expression(matrix_type matrix, vector_type vector) HMPC_NOEXCEPT
+            : matrix(matrix)
+            , vector(vector)
+        {
+            HMPC_HOST_ASSERT(matrix.shape().get(hmpc::size_constant_of<matrix_rank - 1>) == vector.shape().get(hmpc::size_constant_of<vector_rank - 1>));
+        }
+
+        constexpr matrix_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return matrix;
+        }
+
+        constexpr vector_type const& get(hmpc::size_constant<1>) const HMPC_NOEXCEPT
+        {
+            return vector;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        static constexpr hmpc::access::multiple_tag access(hmpc::size_constant<1>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return matrix_vector_product_shape(matrix.shape(), vector.shape());
+        }
+
+        constexpr auto operator()(auto& sycl_queue, auto& get_state, auto& get_capability_data, auto& make_capabilities, auto& tensor, auto&) const HMPC_NOEXCEPT
+        {
+            return sycl_queue.submit([&](auto& handler)
             {
-                return ([&]()
+                auto state = get_state(handler);
+                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                auto element_shape = hmpc::element_shape<value_type>(shape());
+                auto capability_data = get_capability_data(element_shape);
+                hmpc::size extent = matrix.shape().get(hmpc::size_constant_of<matrix_rank - 1>);
+
+                handler.parallel_for(sycl::range{element_shape.size()}, [=](hmpc::size id)
                 {
-                    constexpr auto index_rank = Index::rank;
-                    auto matrix_index = hmpc::iter::for_packed_range<matrix_rank - 1>([&](auto... i)
+                    auto index = hmpc::from_linear_index(id, element_shape);
+                    constexpr auto index_rank = decltype(index)::rank;
+                    auto capabilities = make_capabilities(capability_data, index, element_shape);
+
+                    auto matrix_index = [&](hmpc::size k)
                     {
-                        return hmpc::iter::for_packed_range<matrix_rank - 1, index_rank>([&](auto... j)
+                        return hmpc::iter::for_packed_range<matrix_rank - 1>([&](auto... i)
                         {
-                            return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            return hmpc::iter::for_packed_range<matrix_rank - 1, index_rank>([&](auto... j)
+                            {
+                                return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            });
                         });
-                    });
+                    };
 
-                    auto vector_index = hmpc::iter::for_packed_range<vector_rank - 1>([&](auto... i)
+                    auto vector_index = [&](hmpc::size k)
                     {
-                        return hmpc::iter::for_packed_range<vector_rank, index_rank>([&](auto... j)
+                        return hmpc::iter::for_packed_range<vector_rank - 1>([&](auto... i)
                         {
-                            return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            return hmpc::iter::for_packed_range<vector_rank, index_rank>([&](auto... j)
+                            {
+                                return hmpc::index{index.get(i)..., k, index.get(j)...};
+                            });
                         });
-                    });
+                    };
 
-                    if constexpr (multiply_is_specialized<matrix_value_type, vector_value_type>)
+                    auto matrix_element = [&](hmpc::size k)
                     {
-                        return traits::multiply_specialization<matrix_value_type, vector_value_type>::operator()(
-                            hmpc::detail::tag_of<matrix_type>,
-                            state.get(hmpc::constants::zero),
-                            matrix_index,
-                            hmpc::detail::tag_of<vector_type>,
-                            state.get(hmpc::constants::one),
-                            vector_index,
-                            capabilities
-                        );
-                    }
-                    else
+                        return matrix_type::operator()(state.get(hmpc::constants::zero), matrix_index(k), capabilities);
+                    };
+
+                    auto vector_element = [&](hmpc::size k)
+                    {
+                        return vector_type::operator()(state.get(hmpc::constants::one), vector_index(k), capabilities);
+                    };
+
+                    auto product = [&](hmpc::size k) -> element_type
                     {
-                        return matrix_type::operator()(state.get(hmpc::constants::zero), matrix_index, capabilities) * vector_type::operator()(state.get(hmpc::constants::one), vector_index, capabilities);
-                    }
-                }() + ...);
+                        if constexpr (multiply_is_specialized<matrix_value_type, vector_value_type>)
+                        {
+                            return traits::multiply_specialization<matrix_value_type, vector_value_type>::operator()(
+                                hmpc::detail::tag_of<matrix_type>,
+                                state.get(hmpc::constants::zero),
+                                matrix_index(k),
+                                hmpc::detail::tag_of<vector_type>,
+                                state.get(hmpc::constants::one),
+                                vector_index(k),
+                                capabilities
+                            );
+                        }
+                        else
+                        {
+                            return matrix_element(k) * vector_element(k);
+                        }
+                    };
+
+                    write[id] = detail::blocked_sum_of_products<element_type, use_product_accumulator>(extent, matrix_element, vector_element, product);
+                });
             });
         }
     };
 
+    /// Matrix-vector product over the last dimension of `matrix` (and broadcasting over all other dimensions).
+    /// Uses `blocked_matrix_vector_product_expression` if the summed dimension is dynamic or larger than `max_unrolled_contraction_extent`, and `matrix_vector_product_expression` otherwise.
     template<hmpc::expression Matrix, hmpc::expression Vector>
     constexpr auto matrix_vector_product(Matrix matrix, Vector vector) HMPC_NOEXCEPT
     {
-        return matrix_vector_product_expression<Matrix, Vector>{matrix, vector};
+        using matrix_shape_type = Matrix::shape_type;
+        using vector_shape_type = Vector::shape_type;
+        constexpr auto sum_extent = detail::contraction_extent<matrix_shape_type, matrix_shape_type::rank - 1, vector_shape_type, vector_shape_type::rank - 1>;
+
+        if constexpr (detail::use_contraction_loop<sum_extent> and detail::closed_contraction<typename Matrix::value_type, typename Vector::value_type>)
+        {
+            return blocked_matrix_vector_product_expression<Matrix, Vector>{matrix, vector};
+        }
+        else
+        {
+            return matrix_vector_product_expression<Matrix, Vector>{matrix, vector};
+        }
     }
 }
@@ -7,6 +7,9 @@
 #include <hmpc/ints/num/theory/root_of_unity.hpp>
 #include <hmpc/ints/poly.hpp>
 
+#include <tuple>
+#include <utility>
+
 namespace hmpc::expr
 {
     template<typename T, bool Inverse>
@@ -56,7 +59,7 @@ namespace hmpc::expr
                 {
                     hmpc::comp::host_accessor roots(tensor, hmpc::access::discard_write);
 
-                    constexpr auto normalization = invert(element_type{hmpc::ints::ubigint<32>{limb_type{vector_size}}});
+                    constexpr auto normalization = invert(element_type{hmpc::ints::ubigint<32, limb_type>{limb_type{vector_size}}});
                     if constexpr (Inverse)
                     {
                         roots[0] = normalization;
@@ -195,6 +198,119 @@ namespace hmpc::expr
                 });
             });
         }
+
+        static auto final_transform(sycl::queue& sycl_queue, hmpc::comp::tensor<element_type, vector_size, hmpc::dynamic_extent>& scratch_buffer, auto& tensor, hmpc::comp::tensor<element_type, vector_size>& roots, hmpc::size element_size)
+            requires (Inverse)
+        {
+            return sycl_queue.submit([&](auto& handler)
+            {
+                auto read = hmpc::comp::device_accessor(scratch_buffer, handler, hmpc::access::read);
+                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                auto psis = hmpc::comp::device_accessor(roots, handler, hmpc::access::read);
+
+                handler.parallel_for(sycl::range{vector_size / 2 * element_size}, [=](hmpc::size id)
+                {
+                    hmpc::size tid = id / element_size;
+                    hmpc::size i = id % element_size;
+                    // Inferred from [1]
+                    // Let 0 <= iteration < log2(vector_size) := log2(vector_size) - 1
+                    // Let length = vector_size / 2^(iteration + 1) := 1
+                    // Let 0 <= tid < vector_size / 2
+                    // Let step = (vector_size / length) / 2 := vector_size / 2
+                    // Let psi_step = tid / step := 0
+                    // Let target_idx = (psi_step * step * 2) + (tid mod step) := tid
+                    // Let step_group = length + psi_step := 1
+                    // Let psi = psis[step_group]
+                    // Let u = data[target_idx]
+                    // Let v = data[target_idx + step]
+                    //
+                    // ### Data indices
+                    // Let index = (tid, i)
+                    //     0 <= i < element_size
+                    //     0 <= tid < vector_size / 2
+                    // Read (tid, i)
+                    //  => i + tid * element_size
+                    // Read (tid + step, i)
+                    //  => i + (tid + step) * element_size
+                    // Write (i, tid)
+                    // => tid + i * vector_size
+                    // Write (i, tid + step)
+                    // => tid + step + i * vector_size
+                    constexpr hmpc::size step = vector_size / 2;
+                    auto psi = psis[1];
+
+                    auto index = i + tid * element_size;
+                    auto index_step = i + (tid + step) * element_size;
+                    auto write_index = tid + i * vector_size;
+                    auto write_index_step = tid + step + i * vector_size;
+
+                    element_type u = read[index];
+                    element_type v = read[index_step];
+                    // multiplication of final results by vector_size^{-1}
+                    // psi = psis[1] is already pre-multiplied with vector_size^{-1}
+                    write[write_index] = (u + v) * psis[0];
+                    write[write_index_step] = (u - v) * psi;
+                });
+            });
+        }
+
+        static auto final_transform(sycl::queue& sycl_queue, hmpc::comp::tensor<element_type, vector_size, hmpc::dynamic_extent>& scratch_buffer, auto& tensor, hmpc::comp::tensor<element_type, vector_size>& roots, hmpc::size element_size)
+            requires (not Inverse)
+        {
+            return sycl_queue.submit([&](auto& handler)
+            {
+                auto read = hmpc::comp::device_accessor(scratch_buffer, handler, hmpc::access::read);
+                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                auto psis = hmpc::comp::device_accessor(roots, handler, hmpc::access::read);
+
+                handler.parallel_for(sycl::range{vector_size / 2 * element_size}, [=](hmpc::size id)
+                {
+                    hmpc::size tid = id / element_size;
+                    hmpc::size i = id % element_size;
+                    // [1, Algorithm 8]
+                    // Let 0 <= iteration < log2(vector_size) := log2(vector_size) - 1
+                    // Let length = 2^iteration := vector_size / 2
+                    // Let 0 <= tid < vector_size / 2
+                    // Let step = (vector_size / length) / 2 := 1
+                    // Let psi_step = tid / step := tid
+                    // Let target_idx = (psi_step * step * 2) + (tid mod step) := 2 * tid
+                    // Let step_group = length + psi_step := vector_size / 2 + tid
+                    // Let psi = psis[step_group]
+                    // Let u = data[target_idx]
+                    // Let v = data[target_idx + step]
+                    //
+                    // ### Data indices
+                    // Let index = (tid, i)
+                    //     0 <= i < element_size
+                    //     0 <= tid < vector_size / 2
+                    // Read (target_idx, i)
+                    //  => i + target_idx * element_size
+                    // Read (target_idx + step, i)
+                    //  => i + (target_idx + step) * element_size
+                    // Write (i, target_idx)
+                    // => target_idx + i * vector_size
+                    // Write (i, target_idx + step)
+                    // => target_idx + step + i * vector_size
+                    constexpr hmpc::size length = vector_size / 2;
+                    constexpr hmpc::size step = 1;
+                    hmpc::size target_idx = 2 * tid;
+                    hmpc::size step_group = length + tid;
+                    auto psi = psis[step_group];
+
+                    auto index = i + target_idx * element_size;
+                    auto index_step = i + (target_idx + step) * element_size;
+                    auto write_index = target_idx + i * vector_size;
+                    auto write_index_step = target_idx + step + i * vector_size;
+
+                    element_type u = read[index];
+                    element_type v = read[index_step];
+                    v *= psi;
+
+                    write[write_index] = u + v;
+                    write[write_index_step] = u - v;
+                });
+            });
+        }
     };
 
     template<hmpc::expression E, bool Inverse>
@@ -336,60 +452,7 @@ namespace hmpc::expr
 
             base::inner_transform(sycl_queue, scratch_buffer, roots, inner.shape().size());
 
-            return sycl_queue.submit([&](auto& handler)
-            {
-                auto read = hmpc::comp::device_accessor(scratch_buffer, handler, hmpc::access::read);
-                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
-                auto psis = hmpc::comp::device_accessor(roots, handler, hmpc::access::read);
-                auto element_size = inner.shape().size();
-
-                handler.parallel_for(sycl::range{vector_size / 2 * element_size}, [=](hmpc::size id)
-                {
-                    hmpc::size tid = id / element_size;
-                    hmpc::size i = id % element_size;
-                    // [1, Algorithm 8]
-                    // Let 0 <= iteration < log2(vector_size) := log2(vector_size) - 1
-                    // Let length = 2^iteration := vector_size / 2
-                    // Let 0 <= tid < vector_size / 2
-                    // Let step = (vector_size / length) / 2 := 1
-                    // Let psi_step = tid / step := tid
-                    // Let target_idx = (psi_step * step * 2) + (tid mod step) := 2 * tid
-                    // Let step_group = length + psi_step := vector_size / 2 + tid
-                    // Let psi = psis[step_group]
-                    // Let u = data[target_idx]
-                    // Let v = data[target_idx + step]
-                    //
-                    // ### Data indices
-                    // Let index = (tid, i)
-                    //     0 <= i < element_size
-                    //     0 <= tid < vector_size / 2
-                    // Read (target_idx, i)
-                    //  => i + target_idx * element_size
-                    // Read (target_idx + step, i)
-                    //  => i + (target_idx + step) * element_size
-                    // Write (i, target_idx)
-                    // => target_idx + i * vector_size
-                    // Write (i, target_idx + step)
-                    // => target_idx + step + i * vector_size
-                    constexpr hmpc::size length = vector_size / 2;
-                    constexpr hmpc::size step = 1;
-                    hmpc::size target_idx = 2 * tid;
-                    hmpc::size step_group = length + tid;
-                    auto psi = psis[step_group];
-
-                    auto index = i + target_idx * element_size;
-                    auto index_step = i + (target_idx + step) * element_size;
-                    auto write_index = target_idx + i * vector_size;
-                    auto write_index_step = target_idx + step + i * vector_size;
-
-                    element_type u = read[index];
-                    element_type v = read[index_step];
-                    v *= psi;
-
-                    write[write_index] = u + v;
-                    write[write_index_step] = u - v;
-                });
-            });
+            return base::final_transform(sycl_queue, scratch_buffer, tensor, roots, inner.shape().size());
         }
     };
 
@@ -495,57 +558,329 @@ namespace hmpc::expr
 
             base::inner_transform(sycl_queue, scratch_buffer, roots, inner.shape().size());
 
-            return sycl_queue.submit([&](auto& handler)
+            return base::final_transform(sycl_queue, scratch_buffer, tensor, roots, inner.shape().size());
+        }
+    };
+
+    namespace traits
+    {
+        template<typename E>
+        struct is_number_theoretic_transform : std::false_type
+        {
+        };
+
+        template<hmpc::expression E>
+        struct is_number_theoretic_transform<number_theoretic_transform_expression<E>> : std::true_type
+        {
+        };
+
+        template<typename E>
+        constexpr bool is_number_theoretic_transform_v = is_number_theoretic_transform<E>::value;
+    }
+
+    /// # Batched transforms
+    /// Transforms `E...` (with the same value type and shape) in a single chain of kernels.
+    /// The result has an additional leading dimension of extent `sizeof...(E)`; use `batch_get_expression` to get the individual results.
+    /// Every butterfly of the first and last iteration reads its twiddle factor once and applies it to all batched inputs.
+    template<bool Inverse, hmpc::expression... E>
+        requires (sizeof...(E) > 0)
+    struct batched_number_theoretic_transform_base
+        : public basic_number_theoretic_transform<typename std::tuple_element_t<0, std::tuple<E...>>::value_type, Inverse>
+        , public enable_caching
+    {
+        using first_inner_type = std::tuple_element_t<0, std::tuple<E...>>;
+        using inner_value_type = first_inner_type::value_type;
+        using element_type = hmpc::traits::element_type_t<inner_value_type>;
+        using inner_shape_type = first_inner_type::shape_type;
+        using shape_type = decltype(hmpc::unsqueeze(std::declval<inner_shape_type>(), hmpc::constants::zero, hmpc::size_constant_of<sizeof...(E)>));
+
+        static_assert((std::same_as<typename E::value_type, inner_value_type> and ...));
+        static_assert((std::same_as<typename E::shape_type, inner_shape_type> and ...));
+
+        static constexpr hmpc::size arity = sizeof...(E);
+        static constexpr hmpc::size batch_size = sizeof...(E);
+        using is_complex = void;
+
+        std::tuple<E...> inners;
+
+        constexpr batched_number_theoretic_transform_base(E... inners) HMPC_NOEXCEPT
+            : inners(inners...)
+        {
+        }
+
+        template<hmpc::size I>
+        constexpr auto const& get(hmpc::size_constant<I>) const noexcept
+        {
+            return std::get<I>(inners);
+        }
+
+        template<hmpc::size I>
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<I>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto inner_shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::iter::scan_range<batch_size>([&](auto i, auto shape)
             {
-                auto read = hmpc::comp::device_accessor(scratch_buffer, handler, hmpc::access::read);
-                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                return hmpc::common_shape(shape, std::get<i>(inners).shape());
+            }, std::get<0>(inners).shape());
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::unsqueeze(inner_shape(), hmpc::constants::zero, hmpc::size_constant_of<batch_size>);
+        }
+    };
+
+    template<hmpc::expression... E>
+    struct batched_number_theoretic_transform_expression : public batched_number_theoretic_transform_base<false, E...>
+    {
+        using base = batched_number_theoretic_transform_base<false, E...>;
+
+        using typename base::inner_value_type;
+        using typename base::element_type;
+
+        static_assert(inner_value_type::representation == hmpc::ints::coefficient_representation);
+        using value_type = hmpc::ints::traits::number_theoretic_transform_type_t<inner_value_type>;
+
+        using base::batch_size;
+        using base::inners;
+        using base::vector_size;
+
+        using base::operator();
+
+        constexpr batched_number_theoretic_transform_expression(E... inners) HMPC_NOEXCEPT
+            : base(inners...)
+        {
+        }
+
+        constexpr auto operator()(auto& sycl_queue, auto& get_state, auto& get_capability_data, auto& make_capabilities, auto& tensor, auto& get_extra_tensor) const HMPC_NOEXCEPT
+        {
+            auto& roots = base::get_roots(sycl_queue, get_extra_tensor);
+
+            auto element_size = base::inner_shape().size();
+            auto scratch_buffer_shape = hmpc::shape{hmpc::size_constant_of<vector_size>, hmpc::dynamic_value(batch_size * element_size)};
+
+            auto scratch_buffer = hmpc::comp::make_tensor<element_type>(scratch_buffer_shape);
+
+            sycl_queue.submit([&](auto& handler)
+            {
+                auto state = get_state(handler);
+                auto write = hmpc::comp::device_accessor(scratch_buffer, handler, hmpc::access::discard_write);
                 auto psis = hmpc::comp::device_accessor(roots, handler, hmpc::access::read);
-                auto element_size = inner.shape().size();
+                auto element_shape = hmpc::element_shape<inner_value_type>(base::inner_shape());
+                auto batched_element_shape = hmpc::element_shape<inner_value_type>(base::shape());
+                auto capability_data = get_capability_data(batched_element_shape);
 
-                handler.parallel_for(sycl::range{vector_size / 2 * element_size}, [=](hmpc::size id)
+                handler.parallel_for(sycl::range{element_size * vector_size / 2}, [=](hmpc::size id)
                 {
-                    hmpc::size tid = id / element_size;
-                    hmpc::size i = id % element_size;
-                    // Inferred from [1]
-                    // Let 0 <= iteration < log2(vector_size) := log2(vector_size) - 1
-                    // Let length = vector_size / 2^(iteration + 1) := 1
-                    // Let 0 <= tid < vector_size / 2
-                    // Let step = (vector_size / length) / 2 := vector_size / 2
-                    // Let psi_step = tid / step := 0
-                    // Let target_idx = (psi_step * step * 2) + (tid mod step) := tid
-                    // Let step_group = length + psi_step := 1
-                    // Let psi = psis[step_group]
-                    // Let u = data[target_idx]
-                    // Let v = data[target_idx + step]
+                    hmpc::size i = id / (vector_size / 2);
+                    hmpc::size tid = id % (vector_size / 2);
+                    // Same as the first iteration of `number_theoretic_transform_expression` for every batched input k
                     //
                     // ### Data indices
-                    // Let index = (tid, i)
+                    // Let index = (i, tid)
                     //     0 <= i < element_size
                     //     0 <= tid < vector_size / 2
-                    // Read (tid, i)
-                    //  => i + tid * element_size
-                    // Read (tid + step, i)
-                    //  => i + (tid + step) * element_size
-                    // Write (i, tid)
-                    // => tid + i * vector_size
-                    // Write (i, tid + step)
-                    // => tid + step + i * vector_size
+                    // Read (i, tid) of input k
+                    //  => tid + i * vector_size
+                    // Read (i, tid + step) of input k
+                    //  => tid + step + i * vector_size
+                    // Write (tid, k * element_size + i)
+                    // => k * element_size + i + tid * batch_size * element_size
+                    // Write (tid + step, k * element_size + i)
+                    // => k * element_size + i + (tid + step) * batch_size * element_size
                     constexpr hmpc::size step = vector_size / 2;
                     auto psi = psis[1];
 
-                    auto index = i + tid * element_size;
-                    auto index_step = i + (tid + step) * element_size;
-                    auto write_index = tid + i * vector_size;
-                    auto write_index_step = tid + step + i * vector_size;
+                    hmpc::iter::for_range<batch_size>([&](auto k)
+                    {
+                        using inner_type = std::tuple_element_t<k, std::tuple<E...>>;
 
-                    element_type u = read[index];
-                    element_type v = read[index_step];
-                    // multiplication of final results by vector_size^{-1}
-                    // psi = psis[1] is already pre-multiplied with vector_size^{-1}
-                    write[write_index] = (u + v) * psis[0];
-                    write[write_index_step] = (u - v) * psi;
+                        auto [index, index_step] = [&]()
+                        {
+                            if constexpr (hmpc::expr::same_element_shape<inner_type>)
+                            {
+                                return std::make_pair(tid + i * vector_size, tid + step + i * vector_size);
+                            }
+                            else
+                            {
+                                return std::make_pair(
+                                    hmpc::from_linear_index(tid + i * vector_size, element_shape),
+                                    hmpc::from_linear_index(tid + step + i * vector_size, element_shape)
+                                );
+                            }
+                        }();
+                        auto write_index = k * element_size + i + tid * batch_size * element_size;
+                        auto write_index_step = k * element_size + i + (tid + step) * batch_size * element_size;
+                        // random number generators of different inputs need different counters, so we index into the batched shape
+                        auto capabilities = make_capabilities(capability_data, k * element_size * vector_size + tid + i * vector_size, batched_element_shape);
+
+                        auto u = inner_type::operator()(state.get(k), index, capabilities);
+                        auto v = inner_type::operator()(state.get(k), index_step, capabilities);
+                        v *= psi;
+
+                        write[write_index] = u + v;
+                        write[write_index_step] = u - v;
+                    });
+                });
+            });
+
+            // from here on, the batched inputs are just more polynomials in the scratch buffer
+            base::inner_transform(sycl_queue, scratch_buffer, roots, batch_size * element_size);
+
+            return base::final_transform(sycl_queue, scratch_buffer, tensor, roots, batch_size * element_size);
+        }
+    };
+
+    template<hmpc::expression... E>
+    struct batched_inverse_number_theoretic_transform_expression : public batched_number_theoretic_transform_base<true, E...>
+    {
+        using base = batched_number_theoretic_transform_base<true, E...>;
+
+        using typename base::inner_value_type;
+        using typename base::element_type;
+
+        static_assert(inner_value_type::representation == hmpc::ints::number_theoretic_transform_representation);
+        using value_type = hmpc::ints::traits::coefficient_type_t<inner_value_type>;
+
+        using base::batch_size;
+        using base::inners;
+        using base::vector_size;
+
+        using base::operator();
+
+        constexpr batched_inverse_number_theoretic_transform_expression(E... inners) HMPC_NOEXCEPT
+            : base(inners...)
+        {
+        }
+
+        constexpr auto operator()(auto& sycl_queue, auto& get_state, auto& get_capability_data, auto& make_capabilities, auto& tensor, auto& get_extra_tensor) const HMPC_NOEXCEPT
+        {
+            auto& roots = base::get_roots(sycl_queue, get_extra_tensor);
+
+            auto element_size = base::inner_shape().size();
+            auto scratch_buffer_shape = hmpc::shape{hmpc::size_constant_of<vector_size>, hmpc::dynamic_value(batch_size * element_size)};
+
+            auto scratch_buffer = hmpc::comp::make_tensor<element_type>(scratch_buffer_shape);
+
+            sycl_queue.submit([&](auto& handler)
+            {
+                auto state = get_state(handler);
+                auto write = hmpc::comp::device_accessor(scratch_buffer, handler, hmpc::access::discard_write);
+                auto psis = hmpc::comp::device_accessor(roots, handler, hmpc::access::read);
+                auto element_shape = hmpc::element_shape<inner_value_type>(base::inner_shape());
+                auto batched_element_shape = hmpc::element_shape<inner_value_type>(base::shape());
+                auto capability_data = get_capability_data(batched_element_shape);
+
+                handler.parallel_for(sycl::range{element_size * vector_size / 2}, [=](hmpc::size id)
+                {
+                    hmpc::size i = id / (vector_size / 2);
+                    hmpc::size tid = id % (vector_size / 2);
+                    // Same as the first iteration of `inverse_number_theoretic_transform_expression` for every batched input k
+                    //
+                    // ### Data indices
+                    // Let index = (i, tid)
+                    //     0 <= i < element_size
+                    //     0 <= tid < vector_size / 2
+                    // Read (i, target_idx) of input k
+                    //  => target_idx + i * vector_size
+                    // Read (i, target_idx + step) of input k
+                    //  => target_idx + step + i * vector_size
+                    // Write (target_idx, k * element_size + i)
+                    // => k * element_size + i + target_idx * batch_size * element_size
+                    // Write (target_idx + step, k * element_size + i)
+                    // => k * element_size + i + (target_idx + step) * batch_size * element_size
+                    constexpr hmpc::size length = vector_size / 2;
+                    constexpr hmpc::size step = 1;
+                    hmpc::size target_idx = 2 * tid;
+                    hmpc::size step_group = length + tid;
+                    auto psi = psis[step_group];
+
+                    hmpc::iter::for_range<batch_size>([&](auto k)
+                    {
+                        using inner_type = std::tuple_element_t<k, std::tuple<E...>>;
+
+                        auto [index, index_step] = [&]()
+                        {
+                            if constexpr (hmpc::expr::same_element_shape<inner_type>)
+                            {
+                                return std::make_pair(target_idx + i * vector_size, target_idx + step + i * vector_size);
+                            }
+                            else
+                            {
+                                return std::make_pair(
+                                    hmpc::from_linear_index(target_idx + i * vector_size, element_shape),
+                                    hmpc::from_linear_index(target_idx + step + i * vector_size, element_shape)
+                                );
+                            }
+                        }();
+                        auto write_index = k * element_size + i + target_idx * batch_size * element_size;
+                        auto write_index_step = k * element_size + i + (target_idx + step) * batch_size * element_size;
+                        // random number generators of different inputs need different counters, so we index into the batched shape
+                        auto capabilities = make_capabilities(capability_data, k * element_size * vector_size + target_idx + i * vector_size, batched_element_shape);
+
+                        auto u = inner_type::operator()(state.get(k), index, capabilities);
+                        auto v = inner_type::operator()(state.get(k), index_step, capabilities);
+
+                        write[write_index] = u + v;
+                        write[write_index_step] = (u - v) * psi;
+                    });
                 });
             });
+
+            // from here on, the batched inputs are just more polynomials in the scratch buffer
+            base::inner_transform(sycl_queue, scratch_buffer, roots, batch_size * element_size);
+
+            return base::final_transform(sycl_queue, scratch_buffer, tensor, roots, batch_size * element_size);
+        }
+    };
+
+    /// Selects the result for input `I` from a batched expression (whose shape has a leading batch dimension).
+    template<hmpc::size I, hmpc::expression E>
+    struct batch_get_expression
+    {
+        using inner_type = E;
+        using value_type = inner_type::value_type;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using shape_type = decltype(hmpc::squeeze(std::declval<typename inner_type::shape_type>(), hmpc::constants::zero, hmpc::force));
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        static_assert(I < inner_type::shape_type::extent(hmpc::constants::zero));
+
+        static constexpr hmpc::size arity = 1;
+
+        inner_type inner;
+
+        constexpr batch_get_expression(inner_type const& inner, hmpc::size_constant<I> = {}) HMPC_NOEXCEPT
+            : inner(inner)
+        {
+        }
+
+        constexpr inner_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return inner;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::squeeze(inner.shape(), hmpc::constants::zero, hmpc::force);
+        }
+
+        static constexpr element_type operator()(hmpc::state_with_arity<1> auto const& state, hmpc::mdindex_for<element_shape_type> auto const& index, auto& capabilities) HMPC_NOEXCEPT
+        {
+            auto batch_index = hmpc::iter::for_packed_range<element_shape_type::rank>([&](auto... i)
+            {
+                return hmpc::index{hmpc::size_constant_of<I>, index.get(i)...};
+            });
+            return inner_type::operator()(state.get(hmpc::constants::zero), batch_index, capabilities);
         }
     };
 
@@ -590,4 +925,48 @@ namespace hmpc::expr
             return E::from_parts(inverse_number_theoretic_transform(e.get(i))...);
         });
     }
+
+    /// Transforms all parts of `e` in one batched chain of kernels (see `batched_number_theoretic_transform_base`).
+    template<hmpc::expression_tuple E>
+    constexpr auto batched_number_theoretic_transform(E e)
+    {
+        return hmpc::iter::for_packed_range<E::arity>([&](auto... i)
+        {
+            auto batched = batched_number_theoretic_transform_expression{e.get(i)...};
+            return E::from_parts(batch_get_expression{batched, i}...);
+        });
+    }
+
+    /// Transforms all of `e...` in one batched chain of kernels and returns a `std::tuple` of the results.
+    template<hmpc::expression... E>
+    constexpr auto batched_number_theoretic_transform(E... e)
+    {
+        auto batched = batched_number_theoretic_transform_expression{e...};
+        return hmpc::iter::for_packed_range<sizeof...(E)>([&](auto... i)
+        {
+            return std::make_tuple(batch_get_expression{batched, i}...);
+        });
+    }
+
+    /// Inverse transforms all parts of `e` in one batched chain of kernels (see `batched_number_theoretic_transform_base`).
+    template<hmpc::expression_tuple E>
+    constexpr auto batched_inverse_number_theoretic_transform(E e)
+    {
+        return hmpc::iter::for_packed_range<E::arity>([&](auto... i)
+        {
+            auto batched = batched_inverse_number_theoretic_transform_expression{e.get(i)...};
+            return E::from_parts(batch_get_expression{batched, i}...);
+        });
+    }
+
+    /// Inverse transforms all of `e...` in one batched chain of kernels and returns a `std::tuple` of the results.
+    template<hmpc::expression... E>
+    constexpr auto batched_inverse_number_theoretic_transform(E... e)
+    {
+        auto batched = batched_inverse_number_theoretic_transform_expression{e...};
+        return hmpc::iter::for_packed_range<sizeof...(E)>([&](auto... i)
+        {
+            return std::make_tuple(batch_get_expression{batched, i}...);
+        });
+    }
 }
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <hmpc/detail/utility.hpp>
+#include <hmpc/expr/expression.hpp>
+#include <hmpc/ints/integer_traits.hpp>
+#include <hmpc/ints/num/select.hpp>
+#include <hmpc/shape.hpp>
+
+#include <array>
+
+namespace hmpc::expr
+{
+    /// Element-wise `pow(base, exponent)` with runtime exponents (see `hmpc::ints::pow`)
+    template<hmpc::expression Base, hmpc::expression Exponent, hmpc::size WindowSize>
+    struct pow_expression
+    {
+        using base_type = Base;
+        using exponent_type = Exponent;
+        using base_value_type = base_type::value_type;
+        using exponent_value_type = exponent_type::value_type;
+        using value_type = std::remove_cvref_t<decltype(pow<WindowSize>(std::declval<base_value_type>(), std::declval<exponent_value_type>()))>;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+
+        using base_shape_type = base_type::shape_type;
+        using exponent_shape_type = exponent_type::shape_type;
+
+        static constexpr hmpc::size arity = 2;
+
+        base_type base;
+        exponent_type exponent;
+
+        constexpr pow_expression(base_type base, exponent_type exponent) HMPC_NOEXCEPT
+            : base(base)
+            , exponent(exponent)
+        {
+        }
+
+        constexpr base_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return base;
+        }
+
+        constexpr exponent_type const& get(hmpc::size_constant<1>) const HMPC_NOEXCEPT
+        {
+            return exponent;
+        }
+
+        static constexpr auto access(hmpc::size_constant<0>) noexcept
+        {
+            if constexpr (base_shape_type::rank != exponent_shape_type::rank)
+            {
+                return hmpc::access::multiple;
+            }
+            else if constexpr (base_shape_type::rank == 0)
+            {
+                return hmpc::access::once;
+            }
+            else
+            {
+                return hmpc::iter::scan_range<base_shape_type::rank>([](auto i, auto pattern)
+                {
+                    constexpr auto extent = base_shape_type::extent(i);
+                    if constexpr (extent == hmpc::placeholder_extent and exponent_shape_type::extent(i) != extent)
+                    {
+                        return hmpc::access::multiple;
+                    }
+                    else
+                    {
+                        return pattern;
+                    }
+                }, hmpc::access::once);
+            }
+        }
+
+        static constexpr auto access(hmpc::size_constant<1>) noexcept
+        {
+            if constexpr (base_shape_type::rank != exponent_shape_type::rank)
+            {
+                return hmpc::access::multiple;
+            }
+            else if constexpr (exponent_shape_type::rank == 0)
+            {
+                return hmpc::access::once;
+            }
+            else
+            {
+                return hmpc::iter::scan_range<exponent_shape_type::rank>([](auto i, auto pattern)
+                {
+                    constexpr auto extent = exponent_shape_type::extent(i);
+                    if constexpr (extent == hmpc::placeholder_extent and base_shape_type::extent(i) != extent)
+                    {
+                        return hmpc::access::multiple;
+                    }
+                    else
+                    {
+                        return pattern;
+                    }
+                }, hmpc::access::once);
+            }
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return hmpc::common_shape(base.shape(), exponent.shape());
+        }
+
+        using shape_type = decltype(hmpc::common_shape(std::declval<base_shape_type>(), std::declval<exponent_shape_type>()));
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        static constexpr element_type operator()(hmpc::state_with_arity<2> auto const& state, hmpc::index_for<element_shape_type> auto const& index, auto& capabilities) HMPC_NOEXCEPT
+        {
+            return pow<WindowSize>(
+                base_type::operator()(state.get(hmpc::constants::zero), index, capabilities),
+                exponent_type::operator()(state.get(hmpc::constants::one), index, capabilities)
+            );
+        }
+    };
+
+    /// # Fixed-base exponentiation
+    /// For a compile-time base g and windows of `WindowSize` bits, we precompute (at compile time)
+    ///     table[w][d] = pow(g, d * pow(2, w * WindowSize))
+    /// for all windows w and digits d.
+    /// Then, pow(g, e) is the product of table[w][e_w] for the digits e_w of e, i.e., one multiplication per window and no squarings.
+    /// Table entries are selected in constant time.
+    template<auto Base, hmpc::expression Exponent, hmpc::size WindowSize>
+    struct fixed_base_pow_expression
+    {
+        using exponent_type = Exponent;
+        using exponent_value_type = exponent_type::value_type;
+        using value_type = std::remove_cvref_t<decltype(Base)>;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using limb_type = value_type::limb_type;
+        using shape_type = exponent_type::shape_type;
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        static_assert(std::same_as<value_type, element_type>);
+        static_assert(std::same_as<limb_type, typename exponent_value_type::limb_type>);
+        static_assert(hmpc::is_unsigned(exponent_value_type::signedness));
+
+        static constexpr hmpc::size limb_bit_size = limb_type::bit_size;
+        static constexpr hmpc::size window_size = WindowSize;
+        static_assert(window_size > 0 and window_size <= limb_bit_size);
+        static constexpr hmpc::size table_size = hmpc::size{1} << window_size;
+        static constexpr hmpc::size window_count = hmpc::detail::div_ceil(exponent_value_type::bit_size, window_size);
+
+        static constexpr auto table = []()
+        {
+            std::array<std::array<value_type, table_size>, window_count> table;
+            auto power = Base;
+            for (hmpc::size w = 0; w < window_count; ++w)
+            {
+                table[w][0] = hmpc::ints::integer_traits<value_type>::one;
+                for (hmpc::size d = 1; d < table_size; ++d)
+                {
+                    table[w][d] = table[w][d - 1] * power;
+                }
+                power = table[w][table_size - 1] * power;
+            }
+            return table;
+        }();
+
+        static constexpr hmpc::size arity = 1;
+
+        exponent_type exponent;
+
+        constexpr fixed_base_pow_expression(exponent_type exponent) HMPC_NOEXCEPT
+            : exponent(exponent)
+        {
+        }
+
+        constexpr exponent_type const& get(hmpc::size_constant<0>) const HMPC_NOEXCEPT
+        {
+            return exponent;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const HMPC_NOEXCEPT
+        {
+            return exponent.shape();
+        }
+
+        static constexpr element_type operator()(hmpc::state_with_arity<1> auto const& state, hmpc::index_for<element_shape_type> auto const& index, auto& capabilities) HMPC_NOEXCEPT
+        {
+            constexpr auto mask = limb_type{static_cast<limb_type::underlying_type>(table_size - 1)};
+
+            auto value = exponent_type::operator()(state.get(hmpc::constants::zero), index, capabilities);
+            auto read = value.span(hmpc::access::read);
+
+            element_type result = hmpc::ints::integer_traits<value_type>::one;
+            hmpc::iter::for_range<window_count>([&](auto w)
+            {
+                constexpr hmpc::size position = w * window_size;
+                constexpr auto limb_index = hmpc::size_constant_of<position / limb_bit_size>;
+                constexpr auto offset = hmpc::size_constant_of<position % limb_bit_size>;
+
+                auto digit = read.read(limb_index) >> offset;
+                if constexpr (offset + window_size > limb_bit_size and limb_index + 1 < read.limb_size)
+                {
+                    digit |= read.read(hmpc::size_constant_of<limb_index + 1>) << hmpc::size_constant_of<limb_bit_size - offset>;
+                }
+                digit &= mask;
+
+                auto factor = table[w][0];
+                hmpc::iter::for_range<hmpc::size{1}, table_size>([&](auto d)
+                {
+                    hmpc::ints::num::select(factor, factor, table[w][d], digit == limb_type{static_cast<limb_type::underlying_type>(d)});
+                });
+                result *= factor;
+            });
+            return result;
+        }
+    };
+
+    template<hmpc::size WindowSize = 4, hmpc::expression Base, hmpc::expression Exponent>
+    constexpr auto pow(Base base, Exponent exponent) HMPC_NOEXCEPT
+    {
+        return pow_expression<Base, Exponent, WindowSize>{base, exponent};
+    }
+
+    template<hmpc::size WindowSize = 4, typename T, T Base, hmpc::expression Exponent>
+    constexpr auto pow(hmpc::constant<T, Base>, Exponent exponent) HMPC_NOEXCEPT
+    {
+        return fixed_base_pow_expression<Base, Exponent, WindowSize>{exponent};
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <hmpc/expr/random/number_generator.hpp>
+#include <hmpc/random/discrete_gaussian.hpp>
+#include <hmpc/random/number_generator.hpp>
+#include <hmpc/shape.hpp>
+#include <hmpc/value.hpp>
+
+namespace hmpc::expr::random
+{
+    /// Element-wise discrete Gaussian noise (see `hmpc::random::discrete_gaussian`)
+    template<hmpc::value T, hmpc::rational_size Sigma, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
+    struct discrete_gaussian_expression : public enable_caching
+    {
+        using enable_caching::operator();
+
+        using value_type = T;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using shape_type = hmpc::shape<Dimensions...>;
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        static constexpr hmpc::size arity = 0;
+
+        using capabilities = hmpc::detail::type_list<hmpc::expr::capabilities::random_number_generator_tag>;
+
+        shape_type HMPC_PRIVATE_MEMBER(shape);
+
+        constexpr discrete_gaussian_expression(shape_type shape) HMPC_NOEXCEPT
+            : HMPC_PRIVATE_MEMBER(shape)(shape)
+        {
+        }
+
+        constexpr shape_type const& shape() const noexcept
+        {
+            return HMPC_PRIVATE_MEMBER(shape);
+        }
+
+        constexpr hmpc::monostate state(auto&) const noexcept
+        {
+            return hmpc::empty;
+        }
+
+        static constexpr element_type operator()(hmpc::monostate, hmpc::index_for<element_shape_type> auto const&, auto& capabilities) HMPC_DEVICE_NOEXCEPT
+        {
+            auto& random = capabilities.get(hmpc::expr::capabilities::random_number_generator);
+            return static_cast<element_type>(hmpc::random::discrete_gaussian(random, hmpc::constant_of<Sigma>, hmpc::constant_of<StatisticalSecurity>));
+        }
+    };
+
+    template<hmpc::value T, hmpc::size Sigma, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
+    constexpr auto discrete_gaussian(hmpc::shape<Dimensions...> shape, hmpc::size_constant<Sigma> = {}, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> = {}) noexcept
+    {
+        return discrete_gaussian_expression<T, Sigma, Tag, StatisticalSecurity, Dimensions...>{shape};
+    }
+
+    template<hmpc::value T, hmpc::size Sigma, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
+    constexpr auto discrete_gaussian(hmpc::expr::random::use_number_generator<Tag>, hmpc::shape<Dimensions...> shape, hmpc::size_constant<Sigma> = {}, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> = {}) noexcept
+    {
+        return discrete_gaussian_expression<T, Sigma, Tag, StatisticalSecurity, Dimensions...>{shape};
+    }
+
+    template<hmpc::value T, hmpc::rational_size Sigma, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
+    constexpr auto discrete_gaussian(hmpc::shape<Dimensions...> shape, hmpc::rational_size_constant<Sigma> = {}, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> = {}) noexcept
+    {
+        return discrete_gaussian_expression<T, Sigma, Tag, StatisticalSecurity, Dimensions...>{shape};
+    }
+
+    template<hmpc::value T, hmpc::rational_size Sigma, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
+    constexpr auto discrete_gaussian(hmpc::expr::random::use_number_generator<Tag>, hmpc::shape<Dimensions...> shape, hmpc::rational_size_constant<Sigma> = {}, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> = {}) noexcept
+    {
+        return discrete_gaussian_expression<T, Sigma, Tag, StatisticalSecurity, Dimensions...>{shape};
+    }
+}
@@ -57,6 +57,57 @@ namespace hmpc::expr::random
         return uniform_expression<T, Tag, StatisticalSecurity, Dimensions...>{shape};
     }
 
+    /// Like `uniform_expression` but samples by rejection (see `hmpc::random::rejection_uniform`)
+    template<hmpc::value T, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
+    struct rejection_uniform_expression : public enable_caching
+    {
+        using enable_caching::operator();
+
+        using value_type = T;
+        using element_type = hmpc::traits::element_type_t<value_type>;
+        using shape_type = hmpc::shape<Dimensions...>;
+        using element_shape_type = hmpc::traits::element_shape_t<value_type, shape_type>;
+
+        static constexpr hmpc::size arity = 0;
+
+        using capabilities = hmpc::detail::type_list<hmpc::expr::capabilities::random_number_generator_tag>;
+
+        shape_type HMPC_PRIVATE_MEMBER(shape);
+
+        constexpr rejection_uniform_expression(shape_type shape) HMPC_NOEXCEPT
+            : HMPC_PRIVATE_MEMBER(shape)(shape)
+        {
+        }
+
+        constexpr hmpc::monostate state(auto&) const noexcept
+        {
+            return hmpc::empty;
+        }
+
+        constexpr shape_type const& shape() const noexcept
+        {
+            return HMPC_PRIVATE_MEMBER(shape);
+        }
+
+        static constexpr element_type operator()(hmpc::monostate, hmpc::index_for<element_shape_type> auto const&, auto& capabilities) HMPC_DEVICE_NOEXCEPT
+        {
+            auto& random = capabilities.get(hmpc::expr::capabilities::random_number_generator);
+            return hmpc::random::rejection_uniform<element_type>(random, hmpc::constant_of<StatisticalSecurity>);
+        }
+    };
+
+    template<hmpc::value T, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
+    constexpr auto rejection_uniform(hmpc::shape<Dimensions...> shape, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> = {}) noexcept
+    {
+        return rejection_uniform_expression<T, Tag, StatisticalSecurity, Dimensions...>{shape};
+    }
+
+    template<hmpc::value T, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
+    constexpr auto rejection_uniform(hmpc::expr::random::use_number_generator<Tag>, hmpc::shape<Dimensions...> shape, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> = {}) noexcept
+    {
+        return rejection_uniform_expression<T, Tag, StatisticalSecurity, Dimensions...>{shape};
+    }
+
     template<hmpc::value T, auto Bound, hmpc::signedness Signedness, auto Tag = []{}, hmpc::statistical_security StatisticalSecurity = default_statistical_security, hmpc::size... Dimensions>
     struct drown_uniform_expression : public enable_caching
     {
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <hmpc/comp/accessor.hpp>
 #include <hmpc/expr/expression.hpp>
 #include <hmpc/ints/integer_traits.hpp>
+#include <hmpc/ints/mod.hpp>
 #include <hmpc/shape.hpp>
 
+#include <sycl/sycl.hpp>
+
 namespace hmpc::reduction
 {
     struct add_tag
@@ -256,45 +260,238 @@ namespace hmpc::expr
         }
     };
 
+    /// Number of work items that reduce one segment in `axis_reduction_expression` (a power of two)
+    constexpr hmpc::size default_reduction_work_group_size = 64;
+
+    /// # Reduction along one axis
+    /// Reduces the elements of `E` along dimension `Axis` of its element shape (e.g., the last dimension of a polynomial tensor are its coefficients),
+    /// i.e., the result has the element shape of `E` without dimension `Axis`.
+    /// Every work group reduces one segment (one output element): each work item first reduces a strided part of the segment
+    /// (sums of `mod` values are accumulated lazily, see `hmpc::ints::traits::sum_accumulator`), and the work group then combines the partial results in local memory.
+    template<hmpc::expression E, typename Operation, hmpc::size Axis, hmpc::size WorkGroupSize = default_reduction_work_group_size>
+    struct axis_reduction_expression : public enable_caching
+    {
+        using enable_caching::operator();
+
+        using inner_type = E;
+        using value_type = inner_type::element_type;
+        using element_type = value_type;
+        using inner_element_shape_type = decltype(hmpc::expr::element_shape(std::declval<inner_type>()));
+        using shape_type = decltype(hmpc::squeeze(std::declval<inner_element_shape_type>(), hmpc::size_constant_of<Axis>, hmpc::force));
+
+        using operation_type = Operation;
+
+        static constexpr hmpc::size axis = Axis;
+        static_assert(axis < inner_element_shape_type::rank);
+
+        static constexpr hmpc::size work_group_size = WorkGroupSize;
+        static_assert(work_group_size > 0);
+        static_assert((work_group_size & (work_group_size - 1)) == 0);
+
+        /// Each work item accumulates at most this many terms (of its strided part) without intermediate reduction
+        static constexpr hmpc::size max_lazy_terms = hmpc::size{1} << 32;
+        static constexpr bool use_sum_accumulator = std::same_as<operation_type, hmpc::reduction::add_tag> and hmpc::ints::has_sum_accumulator<element_type, max_lazy_terms>;
+
+        static constexpr hmpc::size arity = 1;
+        using is_complex = void;
+
+        inner_type inner;
+
+        constexpr axis_reduction_expression(inner_type inner) noexcept
+            : inner(inner)
+        {
+        }
+
+        constexpr inner_type const& get(hmpc::size_constant<0>) const noexcept
+        {
+            return inner;
+        }
+
+        static constexpr hmpc::access::once_tag access(hmpc::size_constant<0>) noexcept
+        {
+            return {};
+        }
+
+        constexpr auto shape() const noexcept
+        {
+            return hmpc::squeeze(hmpc::expr::element_shape(inner), hmpc::size_constant_of<axis>, hmpc::force);
+        }
+
+        constexpr auto operator()(auto& sycl_queue, auto& get_state, auto& get_capability_data, auto& make_capabilities, auto& tensor, auto&) const HMPC_NOEXCEPT
+        {
+            return sycl_queue.submit([&](auto& handler)
+            {
+                auto state = get_state(handler).get(hmpc::constants::zero);
+                auto write = hmpc::comp::device_accessor(tensor, handler, hmpc::access::discard_write);
+                auto element_shape = hmpc::expr::element_shape(inner);
+                auto shape = this->shape();
+                auto capability_data = get_capability_data(element_shape);
+
+                hmpc::size extent = element_shape.get(hmpc::size_constant_of<axis>);
+                HMPC_HOST_ASSERT(hmpc::detail::div_ceil(extent, work_group_size) <= max_lazy_terms);
+
+                sycl::local_accessor<element_type, 1> partials(sycl::range<1>{work_group_size}, handler);
+
+                handler.parallel_for(sycl::nd_range<1>{sycl::range<1>{shape.size() * work_group_size}, sycl::range<1>{work_group_size}}, [=](sycl::nd_item<1> item)
+                {
+                    hmpc::size segment = item.get_group(0);
+                    hmpc::size local_id = item.get_local_id(0);
+                    auto operation = detail::reduction_type_v<operation_type>;
+
+                    auto segment_index = hmpc::from_linear_index(segment, shape);
+                    auto index = [&](hmpc::size k)
+                    {
+                        return hmpc::iter::for_packed_range<axis>([&](auto... i)
+                        {
+                            return hmpc::iter::for_packed_range<axis, shape_type::rank>([&](auto... j)
+                            {
+                                return hmpc::index{segment_index.get(i)..., k, segment_index.get(j)...};
+                            });
+                        });
+                    };
+                    auto element = [&](hmpc::size k)
+                    {
+                        auto inner_index = index(k);
+                        auto capabilities = make_capabilities(capability_data, inner_index, element_shape);
+                        return inner_type::operator()(state, inner_index, capabilities);
+                    };
+
+                    if constexpr (use_sum_accumulator)
+                    {
+                        hmpc::ints::traits::sum_accumulator_t<element_type, max_lazy_terms> accumulator;
+                        for (hmpc::size k = local_id; k < extent; k += work_group_size)
+                        {
+                            accumulator.add(element(k));
+                        }
+                        partials[local_id] = accumulator.reduce();
+                    }
+                    else
+                    {
+                        element_type partial = detail::reduction_identity_v<operation_type, element_type>;
+                        for (hmpc::size k = local_id; k < extent; k += work_group_size)
+                        {
+                            partial = static_cast<element_type>(operation(partial, element(k)));
+                        }
+                        partials[local_id] = partial;
+                    }
+
+                    // tree reduction of the partial results in local memory
+                    for (hmpc::size stride = work_group_size / 2; stride > 0; stride /= 2)
+                    {
+                        sycl::group_barrier(item.get_group());
+                        if (local_id < stride)
+                        {
+                            partials[local_id] = static_cast<element_type>(operation(partials[local_id], partials[local_id + stride]));
+                        }
+                    }
+
+                    if (local_id == 0)
+                    {
+                        write[segment] = partials[0];
+                    }
+                });
+            });
+        }
+    };
+
     template<typename Operation, hmpc::expression E>
     constexpr auto reduce(E expression, Operation) noexcept
     {
         return reduction_expression<E, Operation>{expression};
     }
 
+    /// Reduces `expression` along dimension `axis` of its element shape (negative values count from the last dimension).
+    template<typename Operation, hmpc::expression E, hmpc::maybe_signed_size_constant Axis>
+    constexpr auto reduce(E expression, Operation, Axis axis) noexcept
+    {
+        using element_shape_type = decltype(hmpc::expr::element_shape(expression));
+        constexpr hmpc::size rank = element_shape_type::rank;
+        constexpr hmpc::size normalized_axis = [&]()
+        {
+            if constexpr (axis < 0)
+            {
+                static_assert(-axis <= rank);
+                return rank + axis;
+            }
+            else
+            {
+                static_assert(axis < rank);
+                return axis;
+            }
+        }();
+
+        return axis_reduction_expression<E, Operation, normalized_axis>{expression};
+    }
+
     template<hmpc::expression E>
     constexpr auto sum(E expression) noexcept
     {
         return reduce(expression, hmpc::reduction::add);
     }
 
+    template<hmpc::expression E, hmpc::maybe_signed_size_constant Axis>
+    constexpr auto sum(E expression, Axis axis) noexcept
+    {
+        return reduce(expression, hmpc::reduction::add, axis);
+    }
+
     template<hmpc::expression E>
     constexpr auto product(E expression) noexcept
     {
         return reduce(expression, hmpc::reduction::multiply);
     }
 
+    template<hmpc::expression E, hmpc::maybe_signed_size_constant Axis>
+    constexpr auto product(E expression, Axis axis) noexcept
+    {
+        return reduce(expression, hmpc::reduction::multiply, axis);
+    }
+
     template<hmpc::expression E>
     constexpr auto all(E expression) noexcept
     {
         return reduce(expression, hmpc::reduction::logical_and);
     }
 
+    template<hmpc::expression E, hmpc::maybe_signed_size_constant Axis>
+    constexpr auto all(E expression, Axis axis) noexcept
+    {
+        return reduce(expression, hmpc::reduction::logical_and, axis);
+    }
+
     template<hmpc::expression E>
     constexpr auto any(E expression) noexcept
     {
         return reduce(expression, hmpc::reduction::logical_or);
     }
 
+    template<hmpc::expression E, hmpc::maybe_signed_size_constant Axis>
+    constexpr auto any(E expression, Axis axis) noexcept
+    {
+        return reduce(expression, hmpc::reduction::logical_or, axis);
+    }
+
     template<hmpc::expression E>
     constexpr auto min(E expression) noexcept
     {
         return reduce(expression, hmpc::reduction::min);
     }
 
+    template<hmpc::expression E, hmpc::maybe_signed_size_constant Axis>
+    constexpr auto min(E expression, Axis axis) noexcept
+    {
+        return reduce(expression, hmpc::reduction::min, axis);
+    }
+
     template<hmpc::expression E>
     constexpr auto max(E expression) noexcept
     {
         return reduce(expression, hmpc::reduction::max);
     }
+
+    template<hmpc::expression E, hmpc::maybe_signed_size_constant Axis>
+    constexpr auto max(E expression, Axis axis) noexcept
+    {
+        return reduce(expression, hmpc::reduction::max, axis);
+    }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <hmpc/core/num/convert.hpp>
 #include <hmpc/detail/utility.hpp>
 #include <hmpc/ints/num/add.hpp>
 #include <hmpc/ints/num/bit_and.hpp>
@@ -16,6 +17,8 @@
 #include <hmpc/ints/num/shift_right.hpp>
 #include <hmpc/ints/num/subtract.hpp>
 
+#include <type_traits>
+
 #define HMPC_TEMPLATE_COMPARISON_OPERATOR(T, OP, FUNCTION) \
     template<hmpc::size OtherBits, hmpc::signedness OtherSignedness, typename OtherNormalization> \
     friend constexpr hmpc::bit operator OP(T<Bits, Signedness, Limb, Normalization> const& left, T<OtherBits, OtherSignedness, Limb, OtherNormalization> const& right) HMPC_NOEXCEPT \
@@ -106,24 +109,32 @@ namespace hmpc::ints
             return result;
         }
 
+        template<typename OtherLimb, typename OtherNormal>
+        friend constexpr void convert(bigint& result, bigint<bit_size, signedness, OtherLimb, OtherNormal> const& value) HMPC_NOEXCEPT
+        {
+            hmpc::core::num::convert(result.span(hmpc::access::write), value.span(hmpc::access::read));
+        }
+
         HMPC_TEMPLATE_COMPARISON_OPERATORS(bigint)
         HMPC_TEMPLATE_OPERATORS(bigint)
 
         template<hmpc::size OtherBits>
             requires (hmpc::is_unsigned(signedness))
-        friend consteval auto operator/(bigint<Bits, Signedness, Limb, Normalization> const& left, bigint<OtherBits, Signedness, Limb, Normalization> const& right)
+        friend constexpr auto operator/(bigint<Bits, Signedness, Limb, Normalization> const& left, bigint<OtherBits, Signedness, Limb, Normalization> const& right) HMPC_NOEXCEPT
         {
             bigint<Bits, signedness, Limb, Normalization> result;
-            hmpc::ints::num::divide(result, hmpc::core::compiletime_nullspan<Limb>, left, right);
+            bigint<OtherBits, signedness, Limb, Normalization> remainder;
+            hmpc::ints::num::divide(result, remainder, left, right);
             return result;
         }
 
         template<hmpc::size OtherBits>
             requires (hmpc::is_unsigned(signedness))
-        friend consteval auto operator%(bigint<Bits, Signedness, Limb, Normalization> const& left, bigint<OtherBits, Signedness, Limb, Normalization> const& right)
+        friend constexpr auto operator%(bigint<Bits, Signedness, Limb, Normalization> const& left, bigint<OtherBits, Signedness, Limb, Normalization> const& right) HMPC_NOEXCEPT
         {
+            bigint<Bits, signedness, Limb, Normalization> quotient;
             bigint<OtherBits, signedness, Limb, Normalization> result;
-            hmpc::ints::num::divide(hmpc::core::compiletime_nullspan<Limb>, result, left, right);
+            hmpc::ints::num::divide(quotient, result, left, right);
             return result;
         }
     };
@@ -140,6 +151,44 @@ namespace hmpc::ints
 
     template<typename Limb = hmpc::default_limb>
     constexpr auto one = ubigint<1, Limb>{1};
+
+    /// Convert `value` to the same integer with limb type `Limb`.
+    /// This is mostly useful at compile time, e.g., to use a literal (which always uses `hmpc::default_limb`) as modulus with a different limb type.
+    template<typename Limb, hmpc::size Bits, hmpc::signedness Signedness, typename OtherLimb, typename Normalization>
+    constexpr auto limb_cast(bigint<Bits, Signedness, OtherLimb, Normalization> const& value) HMPC_NOEXCEPT
+    {
+        bigint<Bits, Signedness, Limb, Normalization> result;
+        convert(result, value);
+        return result;
+    }
+
+    namespace traits
+    {
+        /// Limb type to use for an integer with `Bits` bits (e.g., for moduli, see `hmpc::ints::traits::modulus_limb_type`).
+        /// Defaults to `hmpc::default_limb`. With `HMPC_PREFER_WIDE_LIMBS`, integers wider than one default limb use 64-bit limbs (if 128-bit intermediates are available).
+        /// Multiplication and Montgomery reduction are quadratic in the number of limbs, so halving the limb count usually pays off on CPUs with a native 64x64->128 multiplication
+        /// (compare `mod` multiplication with both limb types with the "[benchmark]" tests); devices without a native 64-bit multiply-high (e.g., most GPUs) prefer the default limbs.
+        /// Can be specialized to select a limb type for specific bit sizes.
+        template<hmpc::size Bits>
+        struct preferred_limb_type
+        {
+#if defined(HMPC_PREFER_WIDE_LIMBS) and defined(HMPC_HAS_UINT128)
+            using type = std::conditional_t<(Bits > hmpc::default_limb::bit_size), hmpc::core::uint64, hmpc::default_limb>;
+#else
+            using type = hmpc::default_limb;
+#endif
+        };
+
+        template<hmpc::size Bits>
+        using preferred_limb_type_t = preferred_limb_type<Bits>::type;
+    }
+
+    /// Convert `value` to the limb type selected by `traits::preferred_limb_type`.
+    template<hmpc::size Bits, hmpc::signedness Signedness, typename Limb, typename Normalization>
+    constexpr auto preferred_limb_cast(bigint<Bits, Signedness, Limb, Normalization> const& value) HMPC_NOEXCEPT
+    {
+        return limb_cast<traits::preferred_limb_type_t<Bits>>(value);
+    }
 }
 
 #undef HMPC_TEMPLATE_COMPARISON_OPERATOR
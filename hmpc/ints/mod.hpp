@@ -1,11 +1,17 @@
 #pragma once
 
 #include <hmpc/core/constant_bit_span.hpp>
+#include <hmpc/detail/utility.hpp>
 #include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/num/extract_bit.hpp>
 #include <hmpc/ints/num/modulo.hpp>
 #include <hmpc/ints/num/select.hpp>
+#include <hmpc/ints/num/square.hpp>
 #include <hmpc/ints/numeric.hpp>
 
+#include <array>
+#include <type_traits>
+
 #define HMPC_COMPARISON_OPERATOR(T, OP, FUNCTION) \
     friend constexpr hmpc::bit operator OP(T const& left, T const& right) HMPC_NOEXCEPT \
     { \
@@ -42,7 +48,7 @@
     TARGET; \
     hmpc::core::bit_array<bit_size + bit_size, limb_type, hmpc::without_sign> product; \
     hmpc::ints::num::multiply(product, LEFT, RIGHT); \
-    hmpc::ints::num::montgomery_reduce(RESULT, product, modulus_span, hmpc::size_constant_of<limb_size>, inverse_modulus); \
+    reduce(RESULT, product, hmpc::size_constant_of<limb_size>); \
     return RESULT;
 #define HMPC_OPERATOR(T, OP, BODY) \
     friend constexpr T operator OP(T const& left, T const& right) HMPC_NOEXCEPT \
@@ -70,10 +76,45 @@ namespace hmpc::ints
     };
     constexpr from_uniformly_random_tag from_uniformly_random = {};
 
+    struct from_reduced_uniformly_random_tag
+    {
+    };
+    constexpr from_reduced_uniformly_random_tag from_reduced_uniformly_random = {};
+
+    namespace traits
+    {
+        /// Limb type of `mod<Modulus>`.
+        /// Moduli with default limbs (e.g., literals) use the limb type selected by `preferred_limb_type`; moduli with other limbs (e.g., from `limb_cast`) keep them.
+        /// To opt out for a specific modulus, specialize this trait (e.g., with `type = decltype(Modulus)::limb_type`).
+        template<auto Modulus>
+        struct modulus_limb_type
+        {
+            using type = std::conditional_t<
+                std::same_as<typename decltype(Modulus)::limb_type, hmpc::default_limb>,
+                preferred_limb_type_t<decltype(Modulus)::bit_size>,
+                typename decltype(Modulus)::limb_type
+            >;
+        };
+
+        template<auto Modulus>
+        using modulus_limb_type_t = modulus_limb_type<Modulus>::type;
+    }
+
+    /// Special forms of moduli that allow cheaper reduction (see `mod::structure`).
+    /// - `generic`: Montgomery reduction with `hmpc::ints::num::montgomery_reduce`.
+    ///   This includes moduli c * 2^k + 1 with k >= limb_bit_size (e.g., NTT-friendly primes or the "Goldilocks" prime 2^64 - 2^32 + 1),
+    ///   where the inverse modulus is all ones and the multiplications with it and with the zero, one, or all-ones limbs of the modulus already reduce to shifts and additions.
+    /// - `pseudo_mersenne`: 2^k - c with 0 < c < 2^{limb_bit_size} and more than one limb, reduced with `hmpc::ints::num::pseudo_mersenne_reduce`.
+    enum class modulus_structure
+    {
+        generic,
+        pseudo_mersenne,
+    };
+
     template<auto Modulus>
     struct mod
     {
-        static constexpr auto modulus = Modulus;
+        static constexpr auto modulus = hmpc::ints::limb_cast<traits::modulus_limb_type_t<Modulus>>(Modulus);
         static constexpr auto modulus_constant = hmpc::constant_of<modulus>;
         static constexpr auto modulus_span = hmpc::core::constant_bit_span_from<modulus.span(hmpc::access::read)>;
         static constexpr auto half_modulus = modulus >> hmpc::constants::one;
@@ -95,6 +136,7 @@ namespace hmpc::ints
         using unsigned_type = ubigint<bit_size, limb_type, normal_type>;
         using signed_type = sbigint<bit_size, limb_type, normal_type>;
 
+        /// -modulus^{-1} mod 2^{limb_bit_size}, a constant in `hmpc::ints::num::montgomery_reduce`.
         static constexpr auto inverse_modulus = []()
         {
             constexpr hmpc::ints::ubigint<limb_bit_size + 1, limb_type, normal_type> B = {0, 1};
@@ -111,6 +153,24 @@ namespace hmpc::ints
 
         static_assert(greatest_common_divisor(auxiliary_modulus, modulus) == hmpc::ints::one<limb_type>);
 
+        /// Writing modulus = 2^k - c with k = bit_width(modulus), this is c.
+        static constexpr auto pseudo_mersenne_offset = static_cast<unsigned_type>((hmpc::ints::one<limb_type> << hmpc::size_constant_of<hmpc::ints::bit_width(modulus)>) - modulus);
+
+        static constexpr modulus_structure structure = []()
+        {
+            if constexpr (limb_size > 1 and hmpc::ints::bit_width(pseudo_mersenne_offset) <= limb_bit_size and not hmpc::bool_cast(inverse_modulus.value == hmpc::core::limb_traits<limb_type>::max))
+            {
+                return modulus_structure::pseudo_mersenne;
+            }
+            else
+            {
+                return modulus_structure::generic;
+            }
+        }();
+
+        /// Exponent for inversion via Fermat's little theorem (modulus - 2)
+        static constexpr auto inverse_exponent = hmpc::constant_of<static_cast<unsigned_type>(modulus - hmpc::ints::one<limb_type> - hmpc::ints::one<limb_type>)>;
+
         static constexpr auto reduced_auxiliary_modulus = hmpc::ints::num::bit_copy<unsigned_type>(auxiliary_modulus % modulus);
         static constexpr auto reduced_auxiliary_modulus_span = hmpc::core::constant_bit_span_from<reduced_auxiliary_modulus.span(hmpc::access::read)>;
 
@@ -126,6 +186,21 @@ namespace hmpc::ints
         }();
         static constexpr auto reduced_cubed_auxiliary_modulus_span = hmpc::core::constant_bit_span_from<reduced_cubed_auxiliary_modulus.span(hmpc::access::read)>;
 
+        /// Computes result = value * R'^{-1} mod modulus for R' = pow(2, limb_bit_size * AuxiliaryPower) (see `hmpc::ints::num::montgomery_reduce`),
+        /// with the cheaper reduction for pseudo-Mersenne moduli (see `modulus_structure`).
+        template<typename Result, typename Value, hmpc::size AuxiliaryPower>
+        static constexpr void reduce(Result& result, Value const& value, hmpc::size_constant<AuxiliaryPower> auxiliary_power) HMPC_NOEXCEPT
+        {
+            if constexpr (structure == modulus_structure::pseudo_mersenne)
+            {
+                hmpc::ints::num::pseudo_mersenne_reduce(result, value, modulus_span, auxiliary_power, inverse_modulus, hmpc::size_constant_of<hmpc::ints::bit_width(modulus)>, hmpc::constant_of<pseudo_mersenne_offset.data[0]>);
+            }
+            else
+            {
+                hmpc::ints::num::montgomery_reduce(result, value, modulus_span, auxiliary_power, inverse_modulus);
+            }
+        }
+
     private:
         template<hmpc::size OtherLimbSize>
         static constexpr auto reduced_other_auxiliary_modulus_times_square_auxiliary_modulus_span = []()
@@ -169,7 +244,7 @@ namespace hmpc::ints
             constexpr auto value_bit_size = UnsignedIntegerLike::bit_size;
             hmpc::core::bit_array<value_bit_size + bit_size, limb_type, hmpc::without_sign> intermediate;
             hmpc::ints::num::multiply(intermediate, value, reduced_square_auxiliary_modulus_span);
-            hmpc::ints::num::montgomery_reduce(*this, intermediate, modulus_span, hmpc::size_constant_of<limb_size>, inverse_modulus);
+            reduce(*this, intermediate, hmpc::size_constant_of<limb_size>);
         }
 
         /// We perform montgomery_reduce twice to first reduce the intermediate results to [0,modulus) and then adjust it to be in Montgomery form.
@@ -181,11 +256,11 @@ namespace hmpc::ints
         constexpr void from_unsigned_integer(UnsignedIntegerLike const& value)
         {
             constexpr auto value_limb_size = UnsignedIntegerLike::limb_size;
-            hmpc::ints::num::montgomery_reduce(*this, value, modulus_span, hmpc::size_constant_of<value_limb_size>, inverse_modulus);
+            reduce(*this, value, hmpc::size_constant_of<value_limb_size>);
 
             hmpc::core::bit_array<bit_size + bit_size, limb_type, hmpc::without_sign> intermediate;
             hmpc::ints::num::multiply(intermediate, *this, reduced_other_auxiliary_modulus_times_square_auxiliary_modulus_span<value_limb_size>);
-            hmpc::ints::num::montgomery_reduce(*this, intermediate, modulus_span, hmpc::size_constant_of<limb_size>, inverse_modulus);
+            reduce(*this, intermediate, hmpc::size_constant_of<limb_size>);
         }
 
     public:
@@ -203,6 +278,15 @@ namespace hmpc::ints
             from_unsigned_integer(value);
         }
 
+        /// # Constructor from unsigned integer with other limbs
+        /// Converts value to `limb_type` first (e.g., for literals if `limb_type` is not the default limb, see `traits::modulus_limb_type`).
+        template<hmpc::size Bits, typename OtherLimb, typename OtherNormal>
+            requires (not std::same_as<OtherLimb, limb_type>)
+        explicit constexpr mod(hmpc::ints::ubigint<Bits, OtherLimb, OtherNormal> const& value) HMPC_NOEXCEPT
+            : mod(hmpc::ints::limb_cast<limb_type>(value))
+        {
+        }
+
         /// # Constructor from unsigned integer when generating a uniformly random mod
         /// This simply calls `hmpc::ints::num::montgomery_reduce`.
         /// For R' (based on other_integer_type::limb_size), the output will be (value * R'^{-1} mod modulus).
@@ -211,7 +295,16 @@ namespace hmpc::ints
         explicit constexpr mod(hmpc::ints::ubigint<Bits, limb_type, OtherNormal> const& value, hmpc::ints::from_uniformly_random_tag) HMPC_NOEXCEPT
         {
             using other_integer_type = hmpc::ints::ubigint<Bits, limb_type, OtherNormal>;
-            hmpc::ints::num::montgomery_reduce(*this, value, modulus_span, hmpc::size_constant_of<std::max(limb_size, other_integer_type::limb_size)>, inverse_modulus);
+            reduce(*this, value, hmpc::size_constant_of<std::max(limb_size, other_integer_type::limb_size)>);
+        }
+
+        /// # Constructor from reduced unsigned integer when generating a uniformly random mod
+        /// Requires 0 <= value < modulus.
+        /// The value is used as Montgomery form directly, i.e., the output is (value * auxiliary_modulus^{-1} mod modulus).
+        /// As auxiliary_modulus is invertible and value is uniformly random in [0,modulus), the result is also uniformly random and no reduction is needed.
+        explicit constexpr mod(unsigned_type const& value, hmpc::ints::from_reduced_uniformly_random_tag) HMPC_NOEXCEPT
+        {
+            hmpc::ints::num::bit_copy(*this, value);
         }
 
         /// # Constructor from small signed integer
@@ -252,6 +345,15 @@ namespace hmpc::ints
             from_unsigned_integer(normalized_integer);
         }
 
+        /// # Constructor from signed integer with other limbs
+        /// Converts value to `limb_type` first (see the unsigned version).
+        template<hmpc::size Bits, typename OtherLimb, typename OtherNormal>
+            requires (not std::same_as<OtherLimb, limb_type>)
+        explicit constexpr mod(hmpc::ints::sbigint<Bits, OtherLimb, OtherNormal> const& value) HMPC_NOEXCEPT
+            : mod(hmpc::ints::limb_cast<limb_type>(value))
+        {
+        }
+
         /// # Constructor from other mod
         /// First converts value to a unsigned integer.
         /// Then, shifts the integer value depending on the sign (as if it was a signed integer).
@@ -340,23 +442,45 @@ namespace hmpc::ints
             return result;
         }
 
-        friend consteval mod invert(mod const& value)
+        /// Computes value * value, computing every cross product of limbs only once (see `hmpc::core::num::square`)
+        friend constexpr mod square(mod const& value) HMPC_NOEXCEPT
         {
-            unsigned_type greatest_common_divisor;
-            unsigned_type inverse;
-            hmpc::ints::num::extended_euclidean(greatest_common_divisor, inverse, hmpc::core::compiletime_nullspan<limb_type>, value, modulus);
-            HMPC_COMPILETIME_ASSERT(greatest_common_divisor == hmpc::ints::one<limb_type>);
             hmpc::core::bit_array<bit_size + bit_size, limb_type, hmpc::without_sign> product;
-            hmpc::ints::num::multiply(product, inverse, reduced_cubed_auxiliary_modulus_span);
+            hmpc::ints::num::square(product, value);
             mod result;
-            hmpc::ints::num::montgomery_reduce(result, product, modulus_span, hmpc::size_constant_of<limb_size>, inverse_modulus);
+            reduce(result, product, hmpc::size_constant_of<limb_size>);
             return result;
         }
 
+        /// # Modular inverse
+        /// At compile time, this uses the extended Euclidean algorithm (and requires value to be invertible).
+        /// At runtime (e.g., in kernels), this computes pow(value, modulus - 2) in constant time, which is only correct for a prime modulus.
+        /// Primality is not checked (this would be too expensive at compile time for large moduli), so for composite moduli, only use `invert` in constant evaluation.
+        /// Zero is mapped to zero in this case.
+        friend constexpr mod invert(mod const& value) HMPC_NOEXCEPT
+        {
+            if consteval
+            {
+                unsigned_type greatest_common_divisor;
+                unsigned_type inverse;
+                hmpc::ints::num::extended_euclidean(greatest_common_divisor, inverse, hmpc::core::compiletime_nullspan<limb_type>, value, modulus);
+                HMPC_COMPILETIME_ASSERT(greatest_common_divisor == hmpc::ints::one<limb_type>);
+                hmpc::core::bit_array<bit_size + bit_size, limb_type, hmpc::without_sign> product;
+                hmpc::ints::num::multiply(product, inverse, reduced_cubed_auxiliary_modulus_span);
+                mod result;
+                reduce(result, product, hmpc::size_constant_of<limb_size>);
+                return result;
+            }
+            else
+            {
+                return pow(value, inverse_exponent);
+            }
+        }
+
         explicit constexpr operator unsigned_type() const HMPC_NOEXCEPT
         {
             unsigned_type result;
-            hmpc::ints::num::montgomery_reduce(result, *this, modulus_span, hmpc::size_constant_of<limb_size>, inverse_modulus);
+            reduce(result, *this, hmpc::size_constant_of<limb_size>);
             return result;
         }
 
@@ -378,6 +502,166 @@ namespace hmpc::ints
         }
     };
 
+    /// # Lazy accumulator for sums of products
+    /// Accumulates up to `Terms` products of `mod<Modulus>` values as an unreduced (double-width) integer
+    /// and only performs Montgomery reduction once at the end.
+    ///
+    /// All values are in Montgomery form, i.e., the accumulated sum is S = sum(a_i * R * b_i * R) = sum(a_i * b_i) * R^2.
+    /// Each product is less than pow(2, 2 * mod::bit_size), so S fits into bit_size = 2 * mod::bit_size + bit_width(Terms) bits.
+    /// We can perform montgomery_reduce(S) with auxiliary power R' = pow(2, limb_bit_size * r) whenever S < R' * modulus.
+    /// - If this holds for R' = R, montgomery_reduce(S) == sum(a_i * b_i) * R is the result in Montgomery form.
+    /// - Otherwise, we pick r > limb_size large enough and get y = sum(a_i * b_i) * R^2 * R'^{-1}.
+    ///   Then, montgomery_reduce(y * (R' mod modulus)) == sum(a_i * b_i) * R.
+    template<auto Modulus, hmpc::size Terms>
+    struct mod_accumulator
+    {
+        static_assert(Terms > 0);
+
+        using value_type = mod<Modulus>;
+        using limb_type = value_type::limb_type;
+        using normal_type = value_type::normal_type;
+
+        static constexpr hmpc::size terms = Terms;
+        static constexpr hmpc::size bit_size = value_type::bit_size + value_type::bit_size + hmpc::detail::bit_width(terms);
+        static constexpr hmpc::size limb_size = hmpc::core::limb_size_for<limb_type>(bit_size);
+
+        static constexpr hmpc::size auxiliary_power = std::max(
+            value_type::limb_size,
+            hmpc::core::limb_size_for<limb_type>(bit_size - value_type::bit_size + 1)
+        );
+
+    private:
+        static constexpr auto reduced_other_auxiliary_modulus_span = []()
+        {
+            constexpr auto reduced_other_auxiliary_modulus = []()
+            {
+                constexpr auto other_auxiliary_modulus = []()
+                {
+                    hmpc::ints::ubigint<value_type::limb_bit_size * auxiliary_power + 1, limb_type, normal_type> R = {};
+                    R.span(hmpc::access::write).write(hmpc::size_constant_of<auxiliary_power>, hmpc::core::limb_traits<limb_type>::one, hmpc::access::unnormal);
+                    return R;
+                }();
+
+                return hmpc::ints::num::bit_copy<typename value_type::unsigned_type>(other_auxiliary_modulus % value_type::modulus);
+            }();
+            return hmpc::core::constant_bit_span_of<reduced_other_auxiliary_modulus>;
+        }();
+
+    public:
+        /// Data member
+        hmpc::core::bit_array<bit_size, limb_type, hmpc::without_sign> data = {};
+
+        /// Adds `left * right` to the accumulated sum without reduction.
+        constexpr void multiply_add(value_type const& left, value_type const& right) HMPC_NOEXCEPT
+        {
+            hmpc::core::bit_array<value_type::bit_size + value_type::bit_size, limb_type, hmpc::without_sign> product;
+            hmpc::ints::num::multiply(product, left, right);
+            hmpc::ints::num::add(data, data, product);
+        }
+
+        /// Reduces the accumulated sum to a `mod` (see above).
+        constexpr value_type reduce() const HMPC_NOEXCEPT
+        {
+            value_type result;
+            value_type::reduce(result, data, hmpc::size_constant_of<auxiliary_power>);
+            if constexpr (auxiliary_power > value_type::limb_size)
+            {
+                hmpc::core::bit_array<value_type::bit_size + value_type::bit_size, limb_type, hmpc::without_sign> intermediate;
+                hmpc::ints::num::multiply(intermediate, result, reduced_other_auxiliary_modulus_span);
+                value_type::reduce(result, intermediate, hmpc::size_constant_of<value_type::limb_size>);
+            }
+            return result;
+        }
+    };
+
+    namespace traits
+    {
+        /// Accumulator type to compute sums of `Terms` products of `T` with lazy reduction.
+        /// Specializations provide `type` with `multiply_add(left, right)` and `reduce()`.
+        template<typename T, hmpc::size Terms>
+        struct product_accumulator
+        {
+        };
+
+        /// Only use lazy accumulation for `mod` if the sum needs at most one extra limb of headroom.
+        template<auto Modulus, hmpc::size Terms>
+            requires (Terms > 1 and mod_accumulator<Modulus, Terms>::limb_size <= 2 * mod<Modulus>::limb_size + 1)
+        struct product_accumulator<mod<Modulus>, Terms>
+        {
+            using type = mod_accumulator<Modulus, Terms>;
+        };
+
+        template<typename T, hmpc::size Terms>
+        using product_accumulator_t = product_accumulator<T, Terms>::type;
+    }
+
+    template<typename T, hmpc::size Terms>
+    concept has_product_accumulator = requires
+    {
+        typename traits::product_accumulator<T, Terms>::type;
+    };
+
+    /// # Lazy accumulator for sums
+    /// Accumulates up to `Terms` `mod<Modulus>` values as an unreduced integer and only reduces once at the end.
+    ///
+    /// All values are in Montgomery form, i.e., the accumulated sum is S = sum(a_i * R mod modulus) < Terms * modulus.
+    /// For Terms <= R, montgomery_reduce(S) == sum(a_i) is the sum in normal form, which is converted back to Montgomery form.
+    template<auto Modulus, hmpc::size Terms>
+    struct mod_sum_accumulator
+    {
+        static_assert(Terms > 0);
+
+        using value_type = mod<Modulus>;
+        using limb_type = value_type::limb_type;
+
+        static constexpr hmpc::size terms = Terms;
+        static constexpr hmpc::size bit_size = value_type::bit_size + hmpc::detail::bit_width(terms);
+        static_assert(hmpc::detail::bit_width(terms - 1) <= value_type::limb_bit_size * value_type::limb_size);
+
+        /// Data member
+        hmpc::core::bit_array<bit_size, limb_type, hmpc::without_sign> data = {};
+
+        /// Adds `value` to the accumulated sum without reduction.
+        constexpr void add(value_type const& value) HMPC_NOEXCEPT
+        {
+            hmpc::ints::num::add(data, data, value);
+        }
+
+        /// Reduces the accumulated sum to a `mod` (see above).
+        constexpr value_type reduce() const HMPC_NOEXCEPT
+        {
+            typename value_type::unsigned_type sum;
+            value_type::reduce(sum, data, hmpc::size_constant_of<value_type::limb_size>);
+            return value_type{sum};
+        }
+    };
+
+    namespace traits
+    {
+        /// Accumulator type to compute sums of `Terms` values of `T` with lazy reduction.
+        /// Specializations provide `type` with `add(value)` and `reduce()`.
+        template<typename T, hmpc::size Terms>
+        struct sum_accumulator
+        {
+        };
+
+        template<auto Modulus, hmpc::size Terms>
+            requires (Terms > 1)
+        struct sum_accumulator<mod<Modulus>, Terms>
+        {
+            using type = mod_sum_accumulator<Modulus, Terms>;
+        };
+
+        template<typename T, hmpc::size Terms>
+        using sum_accumulator_t = sum_accumulator<T, Terms>::type;
+    }
+
+    template<typename T, hmpc::size Terms>
+    concept has_sum_accumulator = requires
+    {
+        typename traits::sum_accumulator<T, Terms>::type;
+    };
+
     template<auto Modulus, hmpc::size Exponent>
     constexpr auto pow(mod<Modulus> value, hmpc::size_constant<Exponent> exponent) HMPC_NOEXCEPT
     {
@@ -400,37 +684,127 @@ namespace hmpc::ints
                 {
                     result *= value;
                 }
-                value *= value;
+                value = square(value);
             });
             return value * result;
         }
     }
 
-    template<auto Modulus, typename T>
+    /// Left-to-right square-and-multiply for a compile-time exponent.
+    /// The sequence of operations only depends on the exponent, so this runs in constant time with respect to value.
+    template<auto Modulus, typename T, T Exponent>
         requires (hmpc::is_unsigned(T::signedness))
-    consteval auto pow(mod<Modulus> value, T const& exponent)
+    constexpr auto pow(mod<Modulus> value, hmpc::constant<T, Exponent>) HMPC_NOEXCEPT
     {
         using mod = mod<Modulus>;
         using limb_type = mod::limb_type;
 
-        if (exponent == hmpc::ints::zero<limb_type>)
+        constexpr hmpc::size bits = hmpc::ints::bit_width(Exponent);
+
+        if constexpr (bits == 0)
         {
             return mod(hmpc::ints::one<limb_type>);
         }
+        else
+        {
+            auto result = value;
+            hmpc::iter::for_range<bits - 1>([&](auto i)
+            {
+                constexpr auto bit = hmpc::size_constant_of<bits - 2 - i>;
+                result = square(result);
+                if constexpr (hmpc::bool_cast(hmpc::ints::num::extract_bit(Exponent, bit)))
+                {
+                    result *= value;
+                }
+            });
+            return result;
+        }
+    }
 
-        auto result = mod(hmpc::ints::one<limb_type>);
+    /// # Exponentiation with a runtime exponent
+    /// At runtime, this uses fixed-window exponentiation with windows of `WindowSize` bits:
+    /// After precomputing table[d] = pow(value, d) for all digits d, every window costs `WindowSize` squarings and one multiplication.
+    /// In contrast to sliding windows, the sequence of operations does not depend on the exponent
+    /// and table entries are selected in constant time (with `select` over the whole table).
+    template<hmpc::size WindowSize = 4, auto Modulus, typename T>
+        requires (hmpc::is_unsigned(T::signedness))
+    constexpr auto pow(mod<Modulus> value, T const& exponent) HMPC_NOEXCEPT
+    {
+        using mod = mod<Modulus>;
+        using limb_type = mod::limb_type;
 
-        auto read = exponent.compiletime_span(hmpc::access::read);
-        for (hmpc::size i = 0; i < T::bit_size; ++i)
+        if consteval
         {
-            if (hmpc::core::num::extract_bit(read, i))
+            if (exponent == hmpc::ints::zero<limb_type>)
             {
-                result *= value;
+                return mod(hmpc::ints::one<limb_type>);
             }
-            value *= value;
+
+            auto result = mod(hmpc::ints::one<limb_type>);
+
+            auto read = exponent.compiletime_span(hmpc::access::read);
+            for (hmpc::size i = 0; i < T::bit_size; ++i)
+            {
+                if (hmpc::core::num::extract_bit(read, i))
+                {
+                    result *= value;
+                }
+                value = square(value);
+            }
+
+            return result;
         }
+        else
+        {
+            constexpr hmpc::size limb_bit_size = limb_type::bit_size;
+            constexpr hmpc::size window_size = WindowSize;
+            static_assert(window_size > 0 and window_size <= limb_bit_size);
+            constexpr hmpc::size table_size = hmpc::size{1} << window_size;
+            constexpr hmpc::size window_count = hmpc::detail::div_ceil(T::bit_size, window_size);
+            constexpr auto mask = limb_type{static_cast<limb_type::underlying_type>(table_size - 1)};
+
+            std::array<mod, table_size> table;
+            table[0] = mod(hmpc::ints::one<limb_type>);
+            table[1] = value;
+            hmpc::iter::for_range<hmpc::size{2}, table_size>([&](auto d)
+            {
+                table[d] = table[d - 1] * value;
+            });
 
-        return result;
+            auto read = exponent.span(hmpc::access::read);
+
+            auto result = table[0];
+            hmpc::iter::for_range<window_count>([&](auto w)
+            {
+                constexpr hmpc::size position = (window_count - 1 - w) * window_size;
+                constexpr auto limb_index = hmpc::size_constant_of<position / limb_bit_size>;
+                constexpr auto offset = hmpc::size_constant_of<position % limb_bit_size>;
+
+                if constexpr (w > 0)
+                {
+                    hmpc::iter::for_range<window_size>([&](auto)
+                    {
+                        result = square(result);
+                    });
+                }
+
+                auto digit = read.read(limb_index) >> offset;
+                if constexpr (offset + window_size > limb_bit_size and limb_index + 1 < read.limb_size)
+                {
+                    digit |= read.read(hmpc::size_constant_of<limb_index + 1>) << hmpc::size_constant_of<limb_bit_size - offset>;
+                }
+                digit &= mask;
+
+                auto factor = table[0];
+                hmpc::iter::for_range<hmpc::size{1}, table_size>([&](auto d)
+                {
+                    hmpc::ints::num::select(factor, factor, table[d], digit == limb_type{static_cast<limb_type::underlying_type>(d)});
+                });
+                result *= factor;
+            });
+
+            return result;
+        }
     }
 }
 
@@ -1,17 +1,84 @@
 #pragma once
 
+#include <hmpc/core/bit_array.hpp>
+#include <hmpc/core/constant_bit_span.hpp>
 #include <hmpc/core/num/divide.hpp>
+#include <hmpc/ints/num/bit_width.hpp>
+#include <hmpc/ints/num/multiply.hpp>
+#include <hmpc/ints/num/select.hpp>
+#include <hmpc/ints/num/shift_right.hpp>
+#include <hmpc/ints/num/subtract.hpp>
 
 namespace hmpc::ints::num
 {
     template<typename Quotient, typename Remainder, typename Numerator, typename Denominator>
-    consteval void divide(Quotient& quotient, Remainder& remainder, Numerator const& numerator, Denominator const& denominator)
+    constexpr void divide(Quotient& quotient, Remainder& remainder, Numerator const& numerator, Denominator const& denominator) HMPC_NOEXCEPT
     {
-        hmpc::core::num::divide(
-            quotient.compiletime_span(hmpc::access::write),
-            remainder.compiletime_span(hmpc::access::write),
-            numerator.compiletime_span(hmpc::access::read),
-            denominator.compiletime_span(hmpc::access::read)
-        );
+        if consteval
+        {
+            hmpc::core::num::divide(
+                quotient.compiletime_span(hmpc::access::write),
+                remainder.compiletime_span(hmpc::access::write),
+                numerator.compiletime_span(hmpc::access::read),
+                denominator.compiletime_span(hmpc::access::read)
+            );
+        }
+        else
+        {
+            hmpc::core::num::divide(
+                quotient.span(hmpc::access::write),
+                remainder.span(hmpc::access::write),
+                numerator.span(hmpc::access::read),
+                denominator.span(hmpc::access::read)
+            );
+        }
+    }
+
+    /// # Division by a compile-time constant
+    /// For a numerator n with N bits and a constant denominator d, we precompute the reciprocal m = floor(2^N / d) at compile time.
+    /// Then, q' = floor(n * m / 2^N) satisfies q - 1 <= q' <= q for the quotient q = floor(n / d),
+    /// so a single multiplication and one constant-time correction step yield the quotient and remainder.
+    template<typename Quotient, typename Remainder, typename Numerator, typename T, T Denominator>
+    constexpr void divide(Quotient& quotient, Remainder& remainder, Numerator const& numerator, hmpc::constant<T, Denominator>) HMPC_NOEXCEPT
+    {
+        using limb_type = Numerator::limb_type;
+        static_assert(hmpc::is_unsigned(Numerator::signedness));
+        static_assert(hmpc::is_unsigned(T::signedness));
+
+        constexpr hmpc::size numerator_bit_size = Numerator::bit_size;
+        constexpr hmpc::size denominator_bit_size = hmpc::ints::num::bit_width(Denominator);
+        static_assert(denominator_bit_size > 0, "Division by zero");
+        constexpr auto denominator = hmpc::core::constant_bit_span_of<Denominator>;
+
+        using reciprocal_type = hmpc::core::bit_array<numerator_bit_size + 1, limb_type, hmpc::without_sign>;
+        constexpr auto reciprocal = []()
+        {
+            constexpr hmpc::size limb_bit_size = limb_type::bit_size;
+            reciprocal_type power = {};
+            power[numerator_bit_size / limb_bit_size] = limb_type{static_cast<limb_type::underlying_type>(limb_type::underlying_type{1} << (numerator_bit_size % limb_bit_size))};
+
+            reciprocal_type reciprocal;
+            hmpc::core::num::divide(reciprocal.span(hmpc::access::write), hmpc::core::write_nullspan<limb_type>, power.span(hmpc::access::read), denominator);
+            return reciprocal;
+        }();
+
+        hmpc::core::bit_array<numerator_bit_size + reciprocal_type::bit_size, limb_type, hmpc::without_sign> product;
+        hmpc::ints::num::multiply(product, numerator, reciprocal);
+
+        hmpc::core::bit_array<numerator_bit_size, limb_type, hmpc::without_sign> estimate;
+        hmpc::ints::num::shift_right(estimate, product, hmpc::size_constant_of<numerator_bit_size>);
+
+        // remainder estimate n - q' * d < 2 * d
+        hmpc::core::bit_array<numerator_bit_size + denominator_bit_size, limb_type, hmpc::without_sign> multiple;
+        hmpc::core::num::multiply(multiple.span(hmpc::access::write), estimate.span(hmpc::access::read), denominator);
+        hmpc::core::bit_array<denominator_bit_size + 1, limb_type, hmpc::without_sign> remainder_estimate;
+        hmpc::ints::num::subtract(remainder_estimate, numerator, multiple);
+
+        hmpc::core::bit_array<denominator_bit_size + 1, limb_type, hmpc::without_sign> difference;
+        auto borrow = hmpc::core::num::subtract(difference.span(hmpc::access::write), remainder_estimate.span(hmpc::access::read), denominator);
+
+        // borrow == 0 iff q' + 1 == q
+        hmpc::ints::num::select(remainder, difference, remainder_estimate, borrow);
+        hmpc::core::num::add(quotient.span(hmpc::access::write), estimate.span(hmpc::access::read), hmpc::core::read_nullspan<limb_type>, not borrow);
     }
 }
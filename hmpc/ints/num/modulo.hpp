@@ -15,4 +15,18 @@ namespace hmpc::ints::num
             inverse_modulus
         );
     }
+
+    template<typename Result, typename Value, hmpc::unsigned_read_only_bit_span Modulus, hmpc::size AuxiliaryPower, hmpc::is_constant_of<typename Result::limb_type> InverseModulus, hmpc::size Shift, hmpc::is_constant_of<typename Result::limb_type> Offset>
+    constexpr void pseudo_mersenne_reduce(Result& result, Value const& value, Modulus modulus, hmpc::size_constant<AuxiliaryPower> auxiliary_power, InverseModulus inverse_modulus, hmpc::size_constant<Shift> shift, Offset offset) HMPC_NOEXCEPT
+    {
+        hmpc::core::num::pseudo_mersenne_reduce(
+            result.span(hmpc::access::write),
+            value.span(hmpc::access::read),
+            modulus,
+            auxiliary_power,
+            inverse_modulus,
+            shift,
+            offset
+        );
+    }
 }
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <hmpc/core/num/square.hpp>
+
+namespace hmpc::ints::num
+{
+    template<typename Result, typename Value>
+    constexpr void square(Result& result, Value const& value) HMPC_NOEXCEPT
+    {
+        hmpc::core::num::square(
+            result.span(hmpc::access::write),
+            value.span(hmpc::access::read)
+        );
+    }
+}
@@ -5,6 +5,7 @@
 #include <hmpc/ints/num/bit_width.hpp>
 #include <hmpc/ints/num/greatest_common_divisor.hpp>
 #include <hmpc/ints/num/has_single_bit.hpp>
+#include <hmpc/ints/num/square.hpp>
 
 namespace hmpc::ints
 {
@@ -45,6 +46,15 @@ namespace hmpc::ints
         }
     }
 
+    /// Computes value * value with a dedicated squaring routine (see `hmpc::core::num::square`)
+    template<hmpc::size Bits, typename Limb, typename Normalization>
+    constexpr auto square(ubigint<Bits, Limb, Normalization> const& value) HMPC_NOEXCEPT
+    {
+        ubigint<Bits + Bits, Limb, Normalization> result;
+        hmpc::ints::num::square(result, value);
+        return result;
+    }
+
     template<typename Quotient, typename Remainder>
     struct divide_result
     {
@@ -53,7 +63,17 @@ namespace hmpc::ints
     };
 
     template<typename Limb, typename Normalization, hmpc::size LeftBits, hmpc::size RightBits>
-    consteval auto divide(ubigint<LeftBits, Limb, Normalization> const& left, ubigint<RightBits, Limb, Normalization> const& right)
+    constexpr auto divide(ubigint<LeftBits, Limb, Normalization> const& left, ubigint<RightBits, Limb, Normalization> const& right) HMPC_NOEXCEPT
+    {
+        ubigint<LeftBits, Limb, Normalization> quotient;
+        ubigint<RightBits, Limb, Normalization> remainder;
+        hmpc::ints::num::divide(quotient, remainder, left, right);
+        return divide_result<decltype(quotient), decltype(remainder)>{quotient, remainder};
+    }
+
+    /// Division by a compile-time constant (see `hmpc::ints::num::divide`)
+    template<typename Limb, typename Normalization, hmpc::size LeftBits, hmpc::size RightBits, ubigint<RightBits, Limb, Normalization> Right>
+    constexpr auto divide(ubigint<LeftBits, Limb, Normalization> const& left, hmpc::constant<ubigint<RightBits, Limb, Normalization>, Right> right) HMPC_NOEXCEPT
     {
         ubigint<LeftBits, Limb, Normalization> quotient;
         ubigint<RightBits, Limb, Normalization> remainder;
@@ -76,7 +96,7 @@ namespace hmpc::ints
         ubigint<max_width, Limb, Normalization> greatest_common_divisor;
         ubigint<ModulusBits, Limb, Normalization> inverse;
         hmpc::ints::num::extended_euclidean(greatest_common_divisor, inverse, hmpc::core::compiletime_nullspan<Limb>, value, modulus);
-        HMPC_COMPILETIME_ASSERT(greatest_common_divisor == ubigint<1>{1});
+        HMPC_COMPILETIME_ASSERT(greatest_common_divisor == hmpc::ints::one<Limb>);
         return inverse;
     }
 }
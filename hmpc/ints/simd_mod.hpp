@@ -0,0 +1,237 @@
+#pragma once
+
+#include <hmpc/ints/mod.hpp>
+
+#include <sycl/sycl.hpp>
+
+#include <array>
+
+namespace hmpc::ints
+{
+    /// # Lane-wise integers modulo
+    /// Holds `Lanes` independent `mod<Modulus>` values in limb-major order (data[j] holds limb j of all lanes),
+    /// which matches the layout of `hmpc::comp::tensor`.
+    /// All operations work on `sycl::vec` lanes, i.e., every instruction processes the same limb of all elements (SIMD across elements).
+    /// This avoids relying on the compiler to vectorize the carry chains of `mod` operators.
+    ///
+    /// Multiplication uses coarsely integrated operand scanning (CIOS) Montgomery multiplication, so results agree with `mod`.
+    template<auto Modulus, hmpc::size Lanes>
+    struct simd_mod
+    {
+        using value_type = mod<Modulus>;
+        using limb_type = value_type::limb_type;
+        using underlying_type = limb_type::underlying_type;
+        using lane_type = sycl::vec<underlying_type, Lanes>;
+
+        static constexpr hmpc::size lanes = Lanes;
+        static constexpr hmpc::size limb_size = value_type::limb_size;
+
+    private:
+        static constexpr auto modulus_limbs = []()
+        {
+            std::array<underlying_type, limb_size> limbs;
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                limbs[j] = value_type::modulus.data[j].data;
+            });
+            return limbs;
+        }();
+        static constexpr underlying_type inverse_modulus = value_type::inverse_modulus.value.data;
+
+        /// Converts a lane mask (-1 for true, 0 for false) to a carry (1 or 0)
+        static constexpr lane_type carry_from(auto mask) HMPC_NOEXCEPT
+        {
+            return mask.template as<lane_type>() & lane_type{1};
+        }
+
+        /// Converts a carry (1 or 0) to a lane mask (all ones or all zeros)
+        static constexpr lane_type mask_from(lane_type carry) HMPC_NOEXCEPT
+        {
+            return lane_type{0} - carry;
+        }
+
+        static constexpr lane_type add_with_carry(lane_type left, lane_type right, lane_type& carry) HMPC_NOEXCEPT
+        {
+            lane_type sum = left + right;
+            lane_type first_carry = carry_from(sum < left);
+            lane_type result = sum + carry;
+            carry = first_carry | carry_from(result < sum);
+            return result;
+        }
+
+        static constexpr lane_type subtract_with_borrow(lane_type left, lane_type right, lane_type& borrow) HMPC_NOEXCEPT
+        {
+            lane_type difference = left - right;
+            lane_type first_borrow = carry_from(left < right);
+            lane_type result = difference - borrow;
+            borrow = first_borrow | carry_from(difference < borrow);
+            return result;
+        }
+
+        /// Returns the lower limb of left * right + addend + carry and sets carry to the upper limb (this cannot overflow)
+        static constexpr lane_type multiply_add(lane_type left, lane_type right, lane_type addend, lane_type& carry) HMPC_NOEXCEPT
+        {
+            lane_type lower = left * right;
+            lane_type upper = sycl::mul_hi(left, right);
+            lane_type sum = lower + addend;
+            upper += carry_from(sum < lower);
+            lane_type result = sum + carry;
+            upper += carry_from(result < sum);
+            carry = upper;
+            return result;
+        }
+
+        /// Subtracts the modulus from value (with `limb_size + 1` limbs, the top one being 0 or 1) if value >= modulus
+        static constexpr simd_mod reduce_once(std::array<lane_type, limb_size> const& value, lane_type top) HMPC_NOEXCEPT
+        {
+            simd_mod difference;
+            lane_type borrow{0};
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                difference.data[j] = subtract_with_borrow(value[j], lane_type{modulus_limbs[j]}, borrow);
+            });
+            // keep value iff value < modulus, i.e., there is no top limb and the subtraction underflows
+            lane_type keep = mask_from(borrow & ~top & lane_type{1});
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                difference.data[j] = (value[j] & keep) | (difference.data[j] & ~keep);
+            });
+            return difference;
+        }
+
+    public:
+        /// Data member
+        std::array<lane_type, limb_size> data;
+
+        constexpr value_type get(hmpc::size lane) const HMPC_NOEXCEPT
+        {
+            value_type result;
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                result.data[j] = limb_type{data[j][lane]};
+            });
+            return result;
+        }
+
+        constexpr void set(hmpc::size lane, value_type const& value) HMPC_NOEXCEPT
+        {
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                data[j][lane] = value.data[j].data;
+            });
+        }
+
+        /// Loads lanes [i, i + lanes) from a limb-major accessor (see `hmpc::comp::tensor`)
+        template<typename Accessor>
+        static constexpr simd_mod load(Accessor const& accessor, hmpc::size i) HMPC_NOEXCEPT
+        {
+            static_assert(std::same_as<typename Accessor::element_type, value_type>);
+            auto pointer = accessor.data();
+            auto count = accessor.element_shape().size();
+            simd_mod result;
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                hmpc::iter::for_range<lanes>([&](auto l)
+                {
+                    result.data[j][l] = pointer[j * count + i + l].data;
+                });
+            });
+            return result;
+        }
+
+        /// Stores lanes to [i, i + lanes) of a limb-major accessor (see `hmpc::comp::tensor`)
+        template<typename Accessor>
+        constexpr void store(Accessor const& accessor, hmpc::size i) const HMPC_NOEXCEPT
+        {
+            static_assert(std::same_as<typename Accessor::element_type, value_type>);
+            auto pointer = accessor.data();
+            auto count = accessor.element_shape().size();
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                hmpc::iter::for_range<lanes>([&](auto l)
+                {
+                    pointer[j * count + i + l] = limb_type{data[j][l]};
+                });
+            });
+        }
+
+        friend constexpr simd_mod operator+(simd_mod const& left, simd_mod const& right) HMPC_NOEXCEPT
+        {
+            std::array<lane_type, limb_size> sum;
+            lane_type carry{0};
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                sum[j] = add_with_carry(left.data[j], right.data[j], carry);
+            });
+            return reduce_once(sum, carry);
+        }
+
+        friend constexpr simd_mod operator-(simd_mod const& left, simd_mod const& right) HMPC_NOEXCEPT
+        {
+            simd_mod result;
+            lane_type borrow{0};
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                result.data[j] = subtract_with_borrow(left.data[j], right.data[j], borrow);
+            });
+            lane_type mask = mask_from(borrow);
+            lane_type carry{0};
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                result.data[j] = add_with_carry(result.data[j], lane_type{modulus_limbs[j]} & mask, carry);
+            });
+            return result;
+        }
+
+        friend constexpr simd_mod operator*(simd_mod const& left, simd_mod const& right) HMPC_NOEXCEPT
+        {
+            std::array<lane_type, limb_size + 2> t;
+            t.fill(lane_type{0});
+
+            hmpc::iter::for_range<limb_size>([&](auto i)
+            {
+                lane_type carry{0};
+                hmpc::iter::for_range<limb_size>([&](auto j)
+                {
+                    t[j] = multiply_add(left.data[j], right.data[i], t[j], carry);
+                });
+                lane_type top_carry{0};
+                t[limb_size] = add_with_carry(t[limb_size], carry, top_carry);
+                t[limb_size + 1] = top_carry;
+
+                lane_type m = t[0] * lane_type{inverse_modulus};
+                carry = lane_type{0};
+                multiply_add(m, lane_type{modulus_limbs[0]}, t[0], carry);
+                hmpc::iter::for_range<hmpc::size{1}, limb_size>([&](auto j)
+                {
+                    t[j - 1] = multiply_add(m, lane_type{modulus_limbs[j]}, t[j], carry);
+                });
+                top_carry = lane_type{0};
+                t[limb_size - 1] = add_with_carry(t[limb_size], carry, top_carry);
+                t[limb_size] = t[limb_size + 1] + top_carry;
+            });
+
+            std::array<lane_type, limb_size> product;
+            hmpc::iter::for_range<limb_size>([&](auto j)
+            {
+                product[j] = t[j];
+            });
+            return reduce_once(product, t[limb_size]);
+        }
+
+        constexpr simd_mod& operator+=(simd_mod const& other) HMPC_NOEXCEPT
+        {
+            return *this = *this + other;
+        }
+
+        constexpr simd_mod& operator-=(simd_mod const& other) HMPC_NOEXCEPT
+        {
+            return *this = *this - other;
+        }
+
+        constexpr simd_mod& operator*=(simd_mod const& other) HMPC_NOEXCEPT
+        {
+            return *this = *this * other;
+        }
+    };
+}
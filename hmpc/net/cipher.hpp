@@ -0,0 +1,190 @@
+#pragma once
+
+#include <hmpc/comp/accessor.hpp>
+#include <hmpc/comp/tensor.hpp>
+#include <hmpc/comp/vector.hpp>
+#include <hmpc/detail/utility.hpp>
+#include <hmpc/expr/crypto/cipher.hpp>
+#include <hmpc/net/queue.hpp>
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <span>
+
+namespace hmpc::net
+{
+    /// Default number of elements per chunk for `broadcast_encrypted`
+    constexpr hmpc::size default_encrypted_chunk_size = hmpc::size{1} << 14;
+
+    /// Chunking of `broadcast_encrypted` (sender and receivers have to agree on `T`, `Engine`, and `ChunkSize`).
+    /// Chunks consist of whole batches of `hmpc::expr::crypto::enc_expression`, so the ciphertext is the same as for `enc`.
+    template<typename T, hmpc::random::engine Engine, hmpc::size ChunkSize>
+    struct encrypted_chunk_limits
+    {
+        using engine_type = Engine;
+        using limb_type = engine_type::value_type;
+
+        static constexpr hmpc::size limb_size = hmpc::traits::limb_size_v<T>;
+        static constexpr hmpc::size block_size = engine_type::block_size;
+        static constexpr hmpc::size batch_size = std::lcm(block_size, limb_size);
+        static constexpr hmpc::size elements_per_batch = batch_size / limb_size;
+        static constexpr hmpc::size blocks_per_batch = batch_size / block_size;
+
+        /// Number of elements per chunk (rounded up to whole batches)
+        static constexpr hmpc::size chunk_size = hmpc::detail::div_ceil(ChunkSize, elements_per_batch) * elements_per_batch;
+        static constexpr hmpc::size chunk_limb_size = chunk_size * limb_size;
+
+        static_assert(std::same_as<limb_type, hmpc::traits::limb_type_t<T>>);
+        static_assert(ChunkSize > 0);
+    };
+
+    /// # Encrypt-and-broadcast (as sender)
+    /// Encrypts `plaintext` with `cipher` (like `hmpc::expr::crypto::enc`) chunk by chunk into two pinned host staging buffers of `ChunkSize` elements
+    /// and sends every chunk to all parties in `communicator` as soon as it is encrypted.
+    /// The device encrypts the next chunk while the current one is sent, and no ciphertext tensor of the full size is materialized.
+    template<hmpc::size ChunkSize = default_encrypted_chunk_size, party_id Id, party_id Sender, party_id... Parties, hmpc::random::engine Engine, typename T, hmpc::size... Dimensions>
+        requires (Sender == Id)
+    void broadcast_encrypted(hmpc::net::queue<Id>& queue, sycl::queue& sycl_queue, communicator<Parties...> communicator, hmpc::party_constant<Sender> sender, hmpc::expr::crypto::cipher_expression<Engine> const& cipher, hmpc::comp::tensor<T, Dimensions...>& plaintext)
+    {
+        using limits = encrypted_chunk_limits<T, Engine, ChunkSize>;
+        using limb_type = limits::limb_type;
+        using element_type = hmpc::traits::element_type_t<T>;
+
+        constexpr hmpc::size limb_size = limits::limb_size;
+        constexpr hmpc::size chunk_size = limits::chunk_size;
+
+        auto element_count = hmpc::element_shape<T>(plaintext.shape()).size();
+        auto chunk_count = hmpc::detail::div_ceil(element_count, chunk_size);
+        auto storage = hmpc::expr::crypto::cipher_storage{cipher};
+
+        auto deleter = [&](limb_type* data)
+        {
+            sycl::free(data, sycl_queue);
+        };
+        auto allocate = [&]()
+        {
+            auto data = std::unique_ptr<limb_type, decltype(deleter)>(sycl::malloc_host<limb_type>(limits::chunk_limb_size, sycl_queue), deleter);
+            if (data == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            return data;
+        };
+        std::array staging
+        {
+            allocate(),
+            allocate(),
+        };
+
+        auto chunk_elements = [&](hmpc::size c)
+        {
+            return std::min(chunk_size, element_count - c * chunk_size);
+        };
+
+        auto encrypt = [&](hmpc::size c)
+        {
+            return sycl_queue.submit([&](auto& handler)
+            {
+                auto read = hmpc::comp::device_accessor(plaintext, handler, hmpc::access::read);
+                auto first_element = c * chunk_size;
+                auto first_batch = first_element / limits::elements_per_batch;
+                auto element_count = chunk_elements(c);
+                auto batch_count = hmpc::detail::div_ceil(element_count, limits::elements_per_batch);
+                auto data = staging[c % 2].get();
+
+                handler.parallel_for(sycl::range{batch_count}, [=](hmpc::size b)
+                {
+                    auto cipher = storage.cipher((first_batch + b) * limits::blocks_per_batch);
+
+                    hmpc::iter::for_range<limits::elements_per_batch>([&](auto e)
+                    {
+                        auto i = b * limits::elements_per_batch + e;
+
+                        if (i < element_count) // the last batch might be too big -> do nothing if out of allowed range
+                        {
+                            element_type element = read[first_element + i];
+
+                            hmpc::core::limb_array<limb_size, limb_type> encrypted_limbs;
+                            cipher.enc(encrypted_limbs.span(hmpc::access::write), element.span(hmpc::access::read));
+
+                            hmpc::iter::for_range<limb_size>([&](auto j)
+                            {
+                                data[i * limb_size + j] = encrypted_limbs[j];
+                            });
+                        }
+                    });
+                });
+            });
+        };
+
+        std::array<sycl::event, 2> events;
+        // if sending throws, the next chunk might still be encrypted into a staging buffer, so wait for it before the buffers are freed
+        struct wait_on_exit
+        {
+            std::array<sycl::event, 2>& events;
+
+            ~wait_on_exit()
+            {
+                for (auto& event : events)
+                {
+                    event.wait();
+                }
+            }
+        } wait_for_pending{events};
+
+        if (chunk_count > 0)
+        {
+            events[0] = encrypt(0);
+        }
+        for (hmpc::size c = 0; c < chunk_count; ++c)
+        {
+            // the buffer of chunk c + 1 was last used for chunk c - 1, which is already sent
+            if (c + 1 < chunk_count)
+            {
+                events[(c + 1) % 2] = encrypt(c + 1);
+            }
+
+            events[c % 2].wait();
+            queue.broadcast_limbs(communicator, sender, std::span<limb_type const>{staging[c % 2].get(), chunk_elements(c) * limb_size});
+        }
+    }
+
+    /// # Encrypt-and-broadcast (as receiver)
+    /// Receives the chunks sent by `broadcast_encrypted` directly into a ciphertext tensor (with the same shape as the result of `hmpc::expr::crypto::enc`).
+    /// Use `hmpc::expr::crypto::dec<T>` to decrypt it.
+    template<typename T, hmpc::random::engine Engine = hmpc::default_random_engine, hmpc::size ChunkSize = default_encrypted_chunk_size, party_id Id, party_id Sender, party_id... Parties>
+        requires (Sender != Id)
+    auto broadcast_encrypted(hmpc::net::queue<Id>& queue, communicator<Parties...> communicator, hmpc::party_constant<Sender> sender, auto const& shape)
+    {
+        using limits = encrypted_chunk_limits<T, Engine, ChunkSize>;
+        using limb_type = limits::limb_type;
+        using limb_vector_type = hmpc::comp::vector<limb_type, limits::limb_size>;
+
+        constexpr hmpc::size limb_size = limits::limb_size;
+        constexpr hmpc::size chunk_size = limits::chunk_size;
+
+        auto element_shape = hmpc::element_shape<T>(shape);
+        auto element_count = element_shape.size();
+        auto chunk_count = hmpc::detail::div_ceil(element_count, chunk_size);
+
+        auto ciphertext = hmpc::comp::make_tensor<limb_type>(hmpc::element_shape<limb_vector_type>(element_shape));
+        {
+            hmpc::comp::host_accessor accessor(ciphertext, hmpc::access::discard_write);
+            auto data = accessor.data();
+
+            for (hmpc::size c = 0; c < chunk_count; ++c)
+            {
+                auto first_element = c * chunk_size;
+                auto chunk_elements = std::min(chunk_size, element_count - first_element);
+                queue.broadcast_limbs(communicator, sender, std::span<limb_type>{data + first_element * limb_size, chunk_elements * limb_size});
+            }
+        }
+
+        return ciphertext;
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <hmpc/comp/crypto/lhe/ciphertext.hpp>
+#include <hmpc/comp/mpc/share.hpp>
+#include <hmpc/comp/tensor.hpp>
+#include <hmpc/expr/crypto/lhe/ciphertext.hpp>
+#include <hmpc/expr/crypto/lhe/distributed_dec.hpp>
+#include <hmpc/expr/mpc/share.hpp>
+#include <hmpc/net/queue.hpp>
+
+namespace hmpc::net
+{
+    /// # Distributed decryption
+    /// Decrypts `ciphertext` (of any shape) with an additive share `key` of the secret key:
+    /// every party computes its drowned decryption share (see `hmpc::expr::crypto::lhe::decryption_share`) in one batch on the device,
+    /// all parties in the communicator of `key` exchange their shares in one all-gather round, and every party decrypts the sum of the shares.
+    /// `Bound` has to bound the coefficients of the noise of `ciphertext`.
+    template<typename Plaintext, auto Bound, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security, party_id Id, party_id... Parties, typename Queue, typename Poly, hmpc::size... Dimensions>
+    auto distributed_dec(hmpc::net::queue<Id>& queue, Queue& comp_queue, hmpc::comp::mpc::share<hmpc::comp::tensor<Poly>, Id, Parties...>& key, hmpc::comp::crypto::lhe::ciphertext<Poly, Dimensions...>& ciphertext, hmpc::constant<decltype(Bound), Bound> bound = {}, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> security = {})
+    {
+        auto share = comp_queue(
+            hmpc::expr::crypto::lhe::decryption_share<Plaintext>(hmpc::expr::mpc::share(key), hmpc::expr::crypto::lhe::ciphertext(ciphertext), bound, security)
+        );
+
+        auto shares = queue.all_gather(key.communicator, std::move(share));
+
+        return comp_queue(hmpc::expr::crypto::lhe::dec<Plaintext>(hmpc::expr::mpc::shares(shares)));
+    }
+}
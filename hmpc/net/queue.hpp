@@ -6,6 +6,8 @@
 #include <hmpc/net/structure.hpp>
 #include <hmpc/typing/reference.hpp>
 
+#include <span>
+
 namespace hmpc::net
 {
     template<party_id Id>
@@ -120,6 +122,52 @@ namespace hmpc::net
             return tensor;
         }
 
+        /// Broadcast of limbs (as sender)
+        ///
+        /// Sends `limbs` (e.g., a chunk of a staging buffer) to all parties in `communicator`.
+        template<party_id Sender, typename Limb, party_id... Parties>
+            requires (Sender == Id)
+        void broadcast_limbs(communicator<Parties...> communicator, hmpc::party_constant<Sender>, std::span<Limb const> limbs)
+        {
+            auto metadata = hmpc::ffi::BroadcastMetadata
+            {
+                .datatype = hmpc::net::traits::message_datatype_of_v<Limb>,
+                .sender = Sender,
+                .size = static_cast<hmpc::net::message_size>(limbs.size_bytes()),
+            };
+
+            auto data = static_cast<hmpc::net::data_ptr>(const_cast<Limb*>(limbs.data()));
+
+            if (auto errc = hmpc::ffi::hmpc_ffi_net_queue_broadcast(handle.get(), metadata, detail::to_ffi(communicator), data); errc != hmpc::ffi::SendReceiveErrc::ok)
+            {
+                hmpc::ffi::throw_exception(errc);
+            }
+        }
+
+        /// Broadcast of limbs (as receiver)
+        ///
+        /// Receives `limbs.size()` limbs from `Sender` into `limbs`.
+        template<party_id Sender, typename Limb, party_id... Parties>
+            requires (Sender != Id)
+        void broadcast_limbs(communicator<Parties...> communicator, hmpc::party_constant<Sender>, std::span<Limb> limbs)
+        {
+            static_assert(((Parties == Id) or ...));
+
+            auto metadata = hmpc::ffi::BroadcastMetadata
+            {
+                .datatype = hmpc::net::traits::message_datatype_of_v<Limb>,
+                .sender = Sender,
+                .size = static_cast<hmpc::net::message_size>(limbs.size_bytes()),
+            };
+
+            auto data = static_cast<hmpc::net::data_ptr>(limbs.data());
+
+            if (auto errc = hmpc::ffi::hmpc_ffi_net_queue_broadcast(handle.get(), metadata, detail::to_ffi(communicator), data); errc != hmpc::ffi::SendReceiveErrc::ok)
+            {
+                hmpc::ffi::throw_exception(errc);
+            }
+        }
+
         /// Multi broadcast (as sender)
         ///
         /// Sends all `tensors` to all parties in `communicator`.
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <hmpc/core/bit_array.hpp>
 #include <hmpc/core/constant_bit_span.hpp>
+#include <hmpc/core/num/popcount.hpp>
 #include <hmpc/core/size_limb_span.hpp>
 #include <hmpc/ints/bigint.hpp>
 #include <hmpc/random/number_generator.hpp>
@@ -38,49 +40,10 @@ namespace hmpc::random
 
         hmpc::core::bit_array<limits::bit_count, limb_type, hmpc::without_sign> bits;
         random.uniform(bits.span(hmpc::access::write));
-        auto read_bits = bits.span(hmpc::access::read);
 
+        // one popcount per limb instead of one (multi-limb) addition per bit
         value_type result;
-        auto read_result = result.span(hmpc::access::read);
-        auto write_result = result.span(hmpc::access::write);
-
-        hmpc::iter::scan_range<Count>([&](auto i, auto current_limb)
-        {
-            if constexpr (i == 0)
-            {
-                hmpc::core::num::add(write_result, hmpc::core::read_nullspan<limb_type>, hmpc::core::read_nullspan<limb_type>, hmpc::bit{current_limb});
-            }
-            else
-            {
-                hmpc::core::num::add(write_result, read_result, hmpc::core::read_nullspan<limb_type>, hmpc::bit{current_limb});
-            }
-
-            constexpr hmpc::size bit = i % limb_type::bit_size;
-            constexpr hmpc::size limb = i / limb_type::bit_size;
-
-            if constexpr (bit == limb_type::bit_size - 1)
-            {
-                if constexpr (limb < read_bits.limb_size - 1)
-                {
-                    return read_bits.read(hmpc::size_constant_of<limb + 1>);
-                }
-                else
-                {
-                    return;
-                }
-            }
-            else
-            {
-                if constexpr (i < count - 1)
-                {
-                    return current_limb >> hmpc::constants::one;
-                }
-                else
-                {
-                    return;
-                }
-            }
-        }, read_bits.read(hmpc::constants::zero));
+        hmpc::ints::num::bit_copy(result, hmpc::core::size_limb_span<limb_type>{hmpc::core::num::popcount(bits.span(hmpc::access::read))});
 
         return result;
     }
@@ -113,10 +76,12 @@ namespace hmpc::random
         using limb_type = limits::limb_type;
         using value_type = limits::value_type;
 
-        auto noncentered_binomial = binomial(random, hmpc::size_constant_of<limits::bit_count>);
+        // (popcount of 4 * Variance bits) - 2 * Variance; no intermediate binomial value is materialized
+        hmpc::core::bit_array<limits::bit_count, limb_type, hmpc::without_sign> bits;
+        random.uniform(bits.span(hmpc::access::write));
 
         value_type result;
-        hmpc::ints::num::subtract(result, noncentered_binomial, hmpc::core::constant_bit_span_from<hmpc::core::size_limb_span<limb_type>(limits::mean)>);
+        hmpc::ints::num::subtract(result, hmpc::core::size_limb_span<limb_type>{hmpc::core::num::popcount(bits.span(hmpc::access::read))}, hmpc::core::constant_bit_span_from<hmpc::core::size_limb_span<limb_type>(limits::mean)>);
 
         return result;
     }
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <hmpc/core/size_limb_span.hpp>
+#include <hmpc/detail/utility.hpp>
+#include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/num/select.hpp>
+#include <hmpc/iter/for_range.hpp>
+#include <hmpc/random/number_generator.hpp>
+#include <hmpc/rational.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace hmpc::random::detail
+{
+    /// sqrt(x) for x >= 0 (Newton's method)
+    consteval long double sqrt(long double x) HMPC_NOEXCEPT
+    {
+        long double y = (x > 1) ? x : 1;
+        for (hmpc::size i = 0; i < 100; ++i)
+        {
+            y = (y + x / y) / 2;
+        }
+        return y;
+    }
+
+    /// 2^exponent as unsigned integer of type `T`
+    template<typename T>
+    consteval T power_of_two(hmpc::size exponent) HMPC_NOEXCEPT
+    {
+        using limb_type = T::limb_type;
+        using underlying_type = limb_type::underlying_type;
+
+        T result = {};
+        result.data[exponent / limb_type::bit_size] = limb_type{static_cast<underlying_type>(underlying_type{1} << (exponent % limb_type::bit_size))};
+        return result;
+    }
+
+    /// Fixed-point product (with `FractionBits` fractional bits) of `left` and `right`, truncated to the type of `left`
+    template<hmpc::size FractionBits, typename T>
+    consteval T fixed_point_multiply(T const& left, T const& right) HMPC_NOEXCEPT
+    {
+        T result;
+        hmpc::ints::num::shift_right(result, left * right, hmpc::size_constant_of<FractionBits>);
+        return result;
+    }
+
+    /// # Gaussian weights in fixed point
+    /// Computes rho(k) = exp(-k^2 / (2 * sigma^2)) * 2^FractionBits (rounded down) for k = 0, ..., Cut and sigma = Sigma.num / Sigma.den with integer arithmetic only:
+    /// 1. For c = 1 / (2 * sigma^2) and the smallest m with c / 2^m < 1, compute exp(c / 2^m) with its Taylor series (all terms are positive).
+    /// 2. Invert it and square it m times to get q = exp(-c).
+    /// 3. Compute rho(k + 1) = rho(k) * q^(2k + 1).
+    /// Every operation truncates by at most one unit; callers keep enough guard bits below the precision they need to absorb the accumulated error.
+    template<hmpc::rational_size Sigma, hmpc::size Cut, hmpc::size FractionBits, typename T>
+    consteval std::array<T, Cut + 1> gaussian_weights() HMPC_NOEXCEPT
+    {
+        using limb_type = T::limb_type;
+        static_assert(T::bit_size > FractionBits + 1);
+        static_assert(Sigma.num < (hmpc::size{1} << 32));
+        static_assert(Sigma.den < (hmpc::size{1} << 32));
+
+        constexpr hmpc::size numerator_square = Sigma.num * Sigma.num;
+        constexpr hmpc::size denominator_square = Sigma.den * Sigma.den;
+
+        auto from_size = [](hmpc::size value)
+        {
+            return hmpc::ints::num::bit_copy<T>(hmpc::core::size_limb_span<limb_type>{value});
+        };
+
+        T const one = power_of_two<T>(FractionBits);
+
+        // x = c / 2^m = den^2 / (2 * num^2 * 2^m) < 1
+        hmpc::size m = 0;
+        while ((denominator_square >> m) > numerator_square)
+        {
+            ++m;
+        }
+        auto c = (from_size(denominator_square) << hmpc::size_constant_of<FractionBits>) / from_size(2 * numerator_square);
+        for (hmpc::size i = 0; i < m; ++i)
+        {
+            decltype(c) half;
+            hmpc::ints::num::shift_right(half, c, hmpc::constants::one);
+            c = half;
+        }
+        auto x = hmpc::ints::num::bit_copy<T>(c);
+
+        // exp(x)
+        T exp = one;
+        T term = one;
+        for (hmpc::size n = 1; hmpc::ints::num::not_equal_to(term, hmpc::ints::zero<limb_type>); ++n)
+        {
+            term = fixed_point_multiply<FractionBits>(term, x) / from_size(n);
+            hmpc::ints::num::add(exp, exp, term);
+        }
+
+        // q = exp(-c)
+        T q;
+        hmpc::ints::num::bit_copy(q, power_of_two<decltype(one * one)>(2 * FractionBits) / exp);
+        for (hmpc::size i = 0; i < m; ++i)
+        {
+            q = fixed_point_multiply<FractionBits>(q, q);
+        }
+        T const q_square = fixed_point_multiply<FractionBits>(q, q);
+
+        std::array<T, Cut + 1> rho;
+        rho[0] = one;
+        T factor = q;
+        for (hmpc::size k = 0; k < Cut; ++k)
+        {
+            rho[k + 1] = fixed_point_multiply<FractionBits>(rho[k], factor);
+            factor = fixed_point_multiply<FractionBits>(factor, q_square);
+        }
+        return rho;
+    }
+}
+
+namespace hmpc::random
+{
+    /// # Cumulative distribution table (CDT) for the discrete Gaussian
+    /// The discrete Gaussian D_sigma has Pr[X = x] proportional to rho(x) = exp(-x^2 / (2 * sigma^2)).
+    /// We cut the tail at tail = ceil(t * sigma) with t = sqrt(2 * ln(2) * security), i.e., Pr[|X| > tail] < exp(-t^2 / 2) = 2^{-security}.
+    ///
+    /// For k = 0, ..., tail - 1, we store
+    ///     table[k] = 2^precision - round(Pr[|X| > k] * 2^precision).
+    /// For uniformly random r with `precision` bits, |X| = #{k : r >= table[k]} then has Pr[|X| > k] = Pr[r >= table[k]] (up to rounding).
+    /// Tail probabilities are summed from the top, so small probabilities do not lose precision.
+    /// Entries that would round to 2^precision are dropped, which only happens for Pr[|X| > k] < 2^{-precision - 1}.
+    /// As precision >= security, this keeps the bound on the tail.
+    ///
+    /// Probabilities are computed in fixed point with `precision + 64` fractional bits at compile time (see `detail::gaussian_weights`),
+    /// so the table does not depend on the floating-point types of the compiler or target.
+    /// The table size grows linearly with sigma; for very wide distributions (e.g., drowning), use `drown_uniform` instead.
+    template<hmpc::rational_size Sigma, hmpc::random::generator RandomGenerator = hmpc::random::number_generator<>, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security>
+    struct discrete_gaussian_limits
+    {
+        static_assert(Sigma.num > 0);
+        static_assert(Sigma.den > 0);
+
+        using limb_type = RandomGenerator::value_type;
+
+        static constexpr long double sigma = static_cast<long double>(Sigma.num) / static_cast<long double>(Sigma.den);
+
+        /// Bits of randomness per sample (excluding the sign): at least 64 and at least the statistical security (rounded up to whole limbs)
+        static constexpr hmpc::size precision = std::max(hmpc::size{64}, hmpc::detail::div_ceil(static_cast<hmpc::size>(StatisticalSecurity), limb_type::bit_size) * limb_type::bit_size);
+
+        using entry_type = hmpc::ints::ubigint<precision, limb_type>;
+
+    private:
+        /// Search bound for the tail (the +1 absorbs rounding of the floating-point bound)
+        static constexpr hmpc::size cut = static_cast<hmpc::size>(hmpc::random::detail::sqrt(2 * 0.693147180559945309417232121458176568L * static_cast<long double>(StatisticalSecurity)) * sigma) + 1;
+
+        static constexpr hmpc::size fraction_bit_size = precision + 64;
+        using fixed_point_type = hmpc::ints::ubigint<fraction_bit_size + hmpc::detail::bit_width(2 * cut + 2) + 1, limb_type>;
+        using scaled_type = hmpc::ints::ubigint<precision + 1, limb_type>;
+
+        /// round(Pr[|X| > k] * 2^precision) for k = 0, ..., cut
+        static constexpr auto scaled_upper_tail = []()
+        {
+            auto rho = hmpc::random::detail::gaussian_weights<Sigma, cut, fraction_bit_size, fixed_point_type>();
+
+            std::array<fixed_point_type, cut + 1> upper_tail;
+            fixed_point_type sum = {};
+            for (hmpc::size k = cut + 1; k-- > 0;)
+            {
+                upper_tail[k] = sum;
+                hmpc::ints::num::add(sum, sum, rho[k]);
+                if (k > 0)
+                {
+                    hmpc::ints::num::add(sum, sum, rho[k]);
+                }
+            }
+
+            auto half_sum = sum >> hmpc::constants::one;
+            std::array<scaled_type, cut + 1> scaled;
+            for (hmpc::size k = 0; k <= cut; ++k)
+            {
+                hmpc::ints::num::bit_copy(scaled[k], ((upper_tail[k] << hmpc::size_constant_of<precision>) + half_sum) / sum);
+            }
+            return scaled;
+        }();
+
+    public:
+        /// Largest absolute value
+        static constexpr hmpc::size tail = []()
+        {
+            hmpc::size k = 0;
+            while (k < cut and hmpc::ints::num::not_equal_to(scaled_upper_tail[k], hmpc::ints::zero<limb_type>))
+            {
+                ++k;
+            }
+            return k;
+        }();
+
+        static constexpr std::array<entry_type, tail> table = []()
+        {
+            auto power = hmpc::random::detail::power_of_two<scaled_type>(precision);
+            std::array<entry_type, tail> table;
+            for (hmpc::size k = 0; k < tail; ++k)
+            {
+                hmpc::ints::num::subtract(table[k], power, scaled_upper_tail[k]);
+            }
+            return table;
+        }();
+
+        /// Bit size of result
+        static constexpr hmpc::size bit_size = hmpc::detail::bit_width(tail) + 1;
+
+        using value_type = hmpc::ints::sbigint<bit_size, limb_type, hmpc::access::unnormal_tag>;
+
+        static constexpr hmpc::constant<value_type, hmpc::ints::num::bit_copy<value_type>(hmpc::core::size_limb_span<limb_type>(tail))> max = {};
+        static constexpr hmpc::constant<value_type, -max.value> min = {};
+    };
+
+    /// Samples from the discrete Gaussian with standard deviation `Sigma` (see `discrete_gaussian_limits`).
+    /// The table lookup compares the random value with every table entry, i.e., it runs in constant time and without branches.
+    template<hmpc::rational_size Sigma, hmpc::random::generator RandomGenerator, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security>
+    constexpr auto discrete_gaussian(RandomGenerator& random, hmpc::rational_size_constant<Sigma> = {}, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> = {}) HMPC_NOEXCEPT
+    {
+        using limits = discrete_gaussian_limits<Sigma, RandomGenerator, StatisticalSecurity>;
+        using limb_type = limits::limb_type;
+        using value_type = limits::value_type;
+
+        typename limits::entry_type sample;
+        random.uniform(sample.span(hmpc::access::write));
+
+        hmpc::size magnitude = 0;
+        hmpc::iter::for_range<limits::tail>([&](auto k)
+        {
+            magnitude += hmpc::ints::num::greater_equal(sample, limits::table[k]).data;
+        });
+
+        hmpc::ints::ubigint<1, limb_type> sign_sample;
+        random.uniform(sign_sample.span(hmpc::access::write));
+        auto sign = hmpc::ints::num::not_equal_to(sign_sample, hmpc::ints::zero<limb_type>);
+
+        value_type positive;
+        hmpc::ints::num::bit_copy(positive, hmpc::core::size_limb_span<limb_type>{magnitude});
+        value_type negative = -positive;
+
+        value_type result;
+        hmpc::ints::num::select(result, positive, negative, sign);
+        return result;
+    }
+}
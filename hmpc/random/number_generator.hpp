@@ -15,6 +15,7 @@ namespace hmpc::random
         Engine::key_size;
         Engine::nonce_size;
         Engine::counter_size;
+        Engine::counters_per_call;
 
         { engine() } -> std::same_as<typename Engine::block_type>;
 
@@ -30,6 +31,7 @@ namespace hmpc::random
         and Generator::key_size == Generator::engine_type::key_size
         and Generator::nonce_size == Generator::engine_type::nonce_size
         and Generator::counter_size == Generator::engine_type::counter_size
+        and Generator::counters_per_call == Generator::engine_type::counters_per_call
         and requires(Generator generator, typename Generator::param_type param)
     {
         generator.uniform(hmpc::core::write_nullspan<typename Generator::value_type>);
@@ -49,6 +51,7 @@ namespace hmpc::random
         static constexpr hmpc::size key_size = engine_type::key_size;
         static constexpr hmpc::size nonce_size = engine_type::nonce_size;
         static constexpr hmpc::size counter_size = engine_type::counter_size;
+        static constexpr hmpc::size counters_per_call = engine_type::counters_per_call;
 
         engine_type engine;
         block_type state;
@@ -62,17 +65,42 @@ namespace hmpc::random
         {
         }
 
-        template<hmpc::write_only_limb_span Result>
-        constexpr void uniform(Result result) HMPC_NOEXCEPT
+        /// Next uniformly random limb.
+        /// Limbs wider than `value_type` (e.g., 64-bit limbs with a 32-bit engine) are composed from multiple consecutive values.
+        template<typename Limb = value_type>
+        constexpr Limb next() HMPC_NOEXCEPT
         {
-            hmpc::iter::for_range<result.limb_size>([&](auto i)
+            if constexpr (std::same_as<Limb, value_type>)
             {
-                result.write(i, state[block_index++]);
+                auto value = state[block_index++];
                 if (block_index == engine_type::block_size)
                 {
                     state = engine();
                     block_index = 0;
                 }
+                return value;
+            }
+            else
+            {
+                static_assert(Limb::bit_size > value_type::bit_size);
+                static_assert(Limb::bit_size % value_type::bit_size == 0);
+                constexpr hmpc::size ratio = Limb::bit_size / value_type::bit_size;
+
+                Limb result = {};
+                hmpc::iter::for_range<ratio>([&](auto i)
+                {
+                    result |= Limb{next()} << hmpc::size_constant_of<i * value_type::bit_size>;
+                });
+                return result;
+            }
+        }
+
+        template<hmpc::write_only_limb_span Result>
+        constexpr void uniform(Result result) HMPC_NOEXCEPT
+        {
+            hmpc::iter::for_range<result.limb_size>([&](auto i)
+            {
+                result.write(i, next<typename Result::limb_type>());
             });
         }
 
@@ -81,12 +109,7 @@ namespace hmpc::random
         {
             hmpc::iter::for_range<result.limb_size>([&](auto i)
             {
-                result.write(i, state[block_index++], hmpc::access::normal);
-                if (block_index == engine_type::block_size)
-                {
-                    state = engine();
-                    block_index = 0;
-                }
+                result.write(i, next<typename Result::limb_type>(), hmpc::access::normal);
             });
         }
 
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <hmpc/detail/utility.hpp>
 #include <hmpc/ints/bigint.hpp>
 #include <hmpc/ints/mod.hpp>
+#include <hmpc/ints/numeric.hpp>
 #include <hmpc/random/number_generator.hpp>
 
 namespace hmpc::random
@@ -64,4 +66,61 @@ namespace hmpc::random
         using value_type = IntegerModulo;
         return value_type(drown_unsigned_uniform(random, value_type::modulus_constant, security), hmpc::ints::from_uniformly_random);
     }
+
+    /// # Limits for rejection sampling modulo q
+    /// Let k = bit_width(q - 1), i.e., 2^{k-1} < q <= 2^k.
+    /// A uniform k-bit candidate is rejected iff it is in [q, 2^k), i.e., with probability (2^k - q) / 2^k < 2^{-gap} for
+    ///     gap = k - bit_width(2^k - q) >= 1.
+    /// With `attempts` = ceil(security / gap) candidates, all of them are rejected with probability less than 2^{-security}.
+    /// For moduli close to a power of two, gap is large and a single candidate (k bits) suffices most of the time,
+    /// compared to k + security bits for `drown_unsigned_uniform`.
+    template<typename IntegerModulo, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security>
+    struct rejection_uniform_limits
+    {
+        using value_type = IntegerModulo;
+        using limb_type = value_type::limb_type;
+
+        /// Number of bits sampled per attempt
+        static constexpr hmpc::size bit_count = value_type::bit_size;
+
+        static constexpr hmpc::size gap = []()
+        {
+            constexpr auto power = hmpc::ints::one<limb_type> << hmpc::size_constant_of<bit_count>;
+            constexpr auto rejected = static_cast<value_type::unsigned_type>(power - value_type::modulus);
+            return bit_count - hmpc::ints::bit_width(rejected);
+        }();
+
+        /// Maximum number of attempts
+        static constexpr hmpc::size attempts = hmpc::detail::div_ceil(static_cast<hmpc::size>(StatisticalSecurity), gap);
+    };
+
+    /// Samples a uniformly random element modulo q by rejection sampling (see `rejection_uniform_limits`).
+    /// Accepted candidates are used as Montgomery form directly (see `hmpc::ints::from_reduced_uniformly_random`).
+    ///
+    /// The number of attempts is bounded, so the result has statistical distance less than 2^{-security} to uniform (like `uniform`).
+    /// Further candidates are only sampled (and only consume random bits) after a rejection, which is rare for moduli close to a power of two.
+    /// Hence, neighboring work items almost never diverge.
+    /// The number of attempts does not leak anything about the result.
+    template<typename IntegerModulo, hmpc::random::generator RandomGenerator, hmpc::statistical_security StatisticalSecurity = hmpc::default_statistical_security>
+    constexpr auto rejection_uniform(RandomGenerator& random, hmpc::constant<hmpc::statistical_security, StatisticalSecurity> = {}) noexcept
+    {
+        using limits = rejection_uniform_limits<IntegerModulo, StatisticalSecurity>;
+        using value_type = IntegerModulo;
+        using unsigned_type = value_type::unsigned_type;
+        static_assert(std::same_as<typename value_type::limb_type, typename RandomGenerator::value_type>);
+
+        unsigned_type result = {};
+        bool accepted = false;
+        for (hmpc::size attempt = 0; attempt < limits::attempts and not accepted; ++attempt)
+        {
+            random.uniform(result.span(hmpc::access::write));
+            accepted = hmpc::bool_cast(hmpc::ints::num::less(result, value_type::modulus));
+        }
+        if (not accepted) // happens with probability less than 2^{-security}
+        {
+            result = {};
+        }
+
+        return value_type(result, hmpc::ints::from_reduced_uniformly_random);
+    }
 }
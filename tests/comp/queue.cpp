@@ -4,6 +4,8 @@
 #include <hmpc/expr/binary_expression.hpp>
 #include <hmpc/expr/cache.hpp>
 #include <hmpc/expr/tensor.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
 #include <hmpc/ints/uint.hpp>
 
 #include <sycl/sycl.hpp>
@@ -73,3 +75,51 @@ TEST_CASE("Queue", "[comp][expr]")
     CHECK(info.limits.parameter_size >= 1024);         // if not custom device
     CHECK(info.limits.local_memory_size >= 32 * 1000); // if not custom device
 }
+
+#ifdef HMPC_HAS_UINT128
+TEST_CASE("Queue with 64-bit limbs", "[comp][expr]")
+{
+    using namespace hmpc::ints::literals;
+    using hmpc::ints::limb_cast;
+    using wide_limb = hmpc::core::uint64;
+
+    constexpr auto p = 0x2faeadbe7a0195c011ac195ad10269830e8001_int;
+    constexpr auto wide_p = limb_cast<wide_limb>(p);
+
+    using mod_p = hmpc::ints::mod<p>;
+    using wide_mod_p = hmpc::ints::mod<wide_p>;
+    using wide_integer = wide_mod_p::unsigned_type;
+
+    constexpr hmpc::size N = 10;
+
+    auto x = hmpc::comp::make_tensor<wide_mod_p>(hmpc::shape{N});
+    auto y = hmpc::comp::make_tensor<wide_mod_p>(hmpc::shape{N});
+    {
+        hmpc::comp::host_accessor access_x(x, hmpc::access::discard_write);
+        hmpc::comp::host_accessor access_y(y, hmpc::access::discard_write);
+
+        for (hmpc::size i = 0; i < N; ++i)
+        {
+            access_x[i] = wide_mod_p(limb_cast<wide_limb>(0x2488b8649d2b26fd819b73b94e54ed3c8dc325_int) + wide_integer{static_cast<wide_limb>(i)});
+            access_y[i] = wide_mod_p(limb_cast<wide_limb>(0x14777bad2b7e4321264fea92350db2982cfaa2_int) + wide_integer{static_cast<wide_limb>(3 * i)});
+        }
+    }
+
+    using namespace hmpc::expr::operators;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto z = queue(hmpc::expr::tensor(x) * hmpc::expr::tensor(y) + hmpc::expr::tensor(x));
+
+    hmpc::comp::host_accessor access_z(z, hmpc::access::read);
+    for (hmpc::size i = 0; i < N; ++i)
+    {
+        // same computation with default limbs on the host
+        auto a = mod_p(0x2488b8649d2b26fd819b73b94e54ed3c8dc325_int + hmpc::ints::ubigint<32>{static_cast<hmpc::default_limb>(i)});
+        auto b = mod_p(0x14777bad2b7e4321264fea92350db2982cfaa2_int + hmpc::ints::ubigint<32>{static_cast<hmpc::default_limb>(3 * i)});
+        auto expected = limb_cast<wide_limb>(static_cast<mod_p::unsigned_type>(a * b + a));
+        wide_mod_p observed = access_z[i];
+        CHECK(static_cast<wide_integer>(observed) == expected);
+    }
+}
+#endif
@@ -0,0 +1,72 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/core/num/divide.hpp>
+#include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/numeric.hpp>
+#include <hmpc/random/number_generator.hpp>
+#include <hmpc/random/uniform.hpp>
+
+namespace
+{
+    template<hmpc::size NumeratorBits, hmpc::size DenominatorBits>
+    void check_divide(auto& rng)
+    {
+        auto numerator = hmpc::random::unsigned_uniform(rng, hmpc::size_constant_of<NumeratorBits>);
+        auto denominator = hmpc::random::unsigned_uniform(rng, hmpc::size_constant_of<DenominatorBits>);
+        if (denominator == hmpc::ints::zero<>)
+        {
+            return;
+        }
+
+        hmpc::ints::ubigint<NumeratorBits> quotient;
+        hmpc::ints::ubigint<DenominatorBits> remainder;
+        hmpc::core::num::divide(quotient.span(hmpc::access::write), remainder.span(hmpc::access::write), numerator.span(hmpc::access::read), denominator.span(hmpc::access::read));
+
+        REQUIRE(remainder < denominator);
+        REQUIRE(quotient * denominator + remainder == numerator);
+    }
+
+    template<auto Denominator, hmpc::size NumeratorBits>
+    void check_constant_divide(auto& rng)
+    {
+        auto numerator = hmpc::random::unsigned_uniform(rng, hmpc::size_constant_of<NumeratorBits>);
+
+        auto [quotient, remainder] = hmpc::ints::divide(numerator, hmpc::constant_of<Denominator>);
+        auto [expected_quotient, expected_remainder] = hmpc::ints::divide(numerator, Denominator);
+
+        REQUIRE(quotient == expected_quotient);
+        REQUIRE(remainder == expected_remainder);
+    }
+}
+
+TEST_CASE("Runtime division", "[core][num][divide]")
+{
+    auto rng = hmpc::random::compiletime_number_generator();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        check_divide<64, 64>(rng);
+        check_divide<128, 10>(rng);
+        check_divide<256, 127>(rng);
+        check_divide<300, 200>(rng);
+    }
+}
+
+TEST_CASE("Division by constants", "[core][num][divide]")
+{
+    using namespace hmpc::ints::literals;
+    auto rng = hmpc::random::compiletime_number_generator();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        check_constant_divide<3_int, 64>(rng);
+        check_constant_divide<1000000007_int, 128>(rng);
+        check_constant_divide<0x7fffffffffffffffffffffffffffffff_int, 256>(rng);
+        check_constant_divide<0x100000000000000000000_int, 200>(rng);
+    }
+
+    auto [quotient, remainder] = hmpc::ints::divide(hmpc::ints::ubigint<32>{0xffffffff}, hmpc::constant_of<255_int>);
+    REQUIRE(quotient == 0x01010101_int);
+    REQUIRE(remainder == 0_int);
+}
@@ -0,0 +1,106 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/core/num/multiply.hpp>
+#include <hmpc/core/num/square.hpp>
+#include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/numeric.hpp>
+#include <hmpc/iter/for_range.hpp>
+#include <hmpc/random/number_generator.hpp>
+#include <hmpc/random/uniform.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+
+namespace
+{
+    template<hmpc::size LeftBits, hmpc::size RightBits>
+    void check_karatsuba(auto& rng)
+    {
+        auto left = hmpc::random::unsigned_uniform(rng, hmpc::size_constant_of<LeftBits>);
+        auto right = hmpc::random::unsigned_uniform(rng, hmpc::size_constant_of<RightBits>);
+
+        hmpc::ints::ubigint<LeftBits + RightBits> expected;
+        hmpc::core::num::schoolbook_multiply(expected.span(hmpc::access::write), left.span(hmpc::access::read), right.span(hmpc::access::read));
+
+        hmpc::ints::ubigint<LeftBits + RightBits> karatsuba;
+        hmpc::core::num::karatsuba_multiply(karatsuba.span(hmpc::access::write), left.span(hmpc::access::read), right.span(hmpc::access::read));
+
+        REQUIRE(karatsuba == expected);
+        REQUIRE(left * right == expected);
+    }
+
+    template<hmpc::size Bits>
+    void check_square(auto& rng)
+    {
+        auto value = hmpc::random::unsigned_uniform(rng, hmpc::size_constant_of<Bits>);
+
+        hmpc::ints::ubigint<Bits + Bits> expected;
+        hmpc::core::num::schoolbook_multiply(expected.span(hmpc::access::write), value.span(hmpc::access::read), value.span(hmpc::access::read));
+
+        hmpc::ints::ubigint<Bits + Bits> square;
+        hmpc::core::num::schoolbook_square(square.span(hmpc::access::write), value.span(hmpc::access::read));
+        REQUIRE(square == expected);
+
+        hmpc::ints::ubigint<Bits> truncated_square;
+        hmpc::core::num::schoolbook_square(truncated_square.span(hmpc::access::write), value.span(hmpc::access::read));
+        REQUIRE(truncated_square == static_cast<hmpc::ints::ubigint<Bits>>(expected));
+    }
+}
+
+TEST_CASE("Karatsuba multiplication", "[core][num][multiply]")
+{
+    auto rng = hmpc::random::compiletime_number_generator();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        check_karatsuba<128, 128>(rng);
+        check_karatsuba<125, 127>(rng);
+        check_karatsuba<1024, 1024>(rng);
+        check_karatsuba<1024, 1000>(rng);
+        check_karatsuba<2048, 1500>(rng);
+    }
+}
+
+TEST_CASE("Squaring", "[core][num][multiply]")
+{
+    auto rng = hmpc::random::compiletime_number_generator();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        check_square<1>(rng);
+        check_square<32>(rng);
+        check_square<127>(rng);
+        check_square<256>(rng);
+        check_square<1000>(rng);
+    }
+
+    auto all_ones = compl hmpc::ints::ubigint<256>{};
+    REQUIRE(hmpc::ints::square(all_ones) == all_ones * all_ones);
+}
+
+TEST_CASE("Multiplication benchmark", "[.][benchmark][core][num][multiply]")
+{
+    auto rng = hmpc::random::compiletime_number_generator();
+
+    hmpc::iter::for_range<hmpc::size{5}>([&](auto i)
+    {
+        constexpr hmpc::size bits = 256 << i;
+
+        auto left = hmpc::random::unsigned_uniform(rng, hmpc::size_constant_of<bits>);
+        auto right = hmpc::random::unsigned_uniform(rng, hmpc::size_constant_of<bits>);
+        hmpc::ints::ubigint<bits + bits> result;
+
+        BENCHMARK("schoolbook " + std::to_string(bits))
+        {
+            hmpc::core::num::schoolbook_multiply(result.span(hmpc::access::write), left.span(hmpc::access::read), right.span(hmpc::access::read));
+            return result;
+        };
+
+        BENCHMARK("karatsuba " + std::to_string(bits))
+        {
+            hmpc::core::num::karatsuba_multiply(result.span(hmpc::access::write), left.span(hmpc::access::read), right.span(hmpc::access::read));
+            return result;
+        };
+    });
+}
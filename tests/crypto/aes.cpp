@@ -0,0 +1,200 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/crypto/aes.hpp>
+#include <hmpc/crypto/cipher.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
+#include <hmpc/random/binomial.hpp>
+#include <hmpc/random/uniform.hpp>
+
+#include <array>
+#include <cstdint>
+
+// Test vectors from [FIPS 197](https://doi.org/10.6028/NIST.FIPS.197-upd1), appendix C (as little-endian 32-bit words)
+
+namespace
+{
+    constexpr hmpc::core::uint32 key[] = {0x0302'0100, 0x0706'0504, 0x0b0a'0908, 0x0f0e'0d0c, 0x1312'1110, 0x1716'1514, 0x1b1a'1918, 0x1f1e'1d1c};
+    // plaintext 00112233445566778899aabbccddeeff == counter || nonce
+    constexpr hmpc::core::uint32 counter[] = {0x3322'1100};
+    constexpr hmpc::core::uint32 nonce[] = {0x7766'5544, 0xbbaa'9988, 0xffee'ddcc};
+}
+
+TEST_CASE("AES", "[crypto][aes]")
+{
+    SECTION("S-box")
+    {
+        std::array<std::uint8_t, 4> bytes = {0x00, 0x01, 0x53, 0xff};
+        hmpc::crypto::detail::aes_sub_bytes(bytes);
+
+        REQUIRE(bytes[0] == 0x63);
+        REQUIRE(bytes[1] == 0x7c);
+        REQUIRE(bytes[2] == 0xed);
+        REQUIRE(bytes[3] == 0x16);
+    }
+
+    SECTION("AES-128")
+    {
+        hmpc::crypto::aes128_ctr aes({key, nonce, counter});
+
+        auto state = aes();
+        REQUIRE(state[0] == 0xd8e0'c469);
+        REQUIRE(state[1] == 0x3004'7b6a);
+        REQUIRE(state[2] == 0x80b7'cdd8);
+        REQUIRE(state[3] == 0x5ac5'b470);
+    }
+
+    SECTION("AES-192")
+    {
+        hmpc::crypto::aes_ctr<6, 3, 1> aes({key, nonce, counter});
+
+        auto state = aes();
+        REQUIRE(state[0] == 0xa47c'a9dd);
+        REQUIRE(state[1] == 0xe0df'4c86);
+        REQUIRE(state[2] == 0xa070'af6e);
+        REQUIRE(state[3] == 0x9171'0dec);
+    }
+
+    SECTION("AES-256")
+    {
+        hmpc::crypto::aes256_ctr aes({key, nonce, counter});
+
+        auto state = aes();
+        REQUIRE(state[0] == 0xcab7'a28e);
+        REQUIRE(state[1] == 0xbf45'6751);
+        REQUIRE(state[2] == 0x9049'fcea);
+        REQUIRE(state[3] == 0x8960'494b);
+    }
+
+    SECTION("Counter mode")
+    {
+        hmpc::crypto::aes128_ctr aes({key, nonce, counter});
+        hmpc::crypto::aes_ctr<4, 3, 1, 1> single_block_aes({key, nonce, counter});
+
+        for (int i = 0; i < 3; ++i)
+        {
+            auto state = aes();
+            hmpc::iter::for_range<decltype(aes)::blocks>([&](auto l)
+            {
+                auto block = single_block_aes();
+                hmpc::iter::for_range<hmpc::size{4}>([&](auto j)
+                {
+                    REQUIRE(state[4 * l + j] == block[j]);
+                });
+            });
+        }
+
+        auto param = aes.param();
+        REQUIRE(param.counter[hmpc::constants::zero] == counter[0] + 12);
+        hmpc::iter::for_range<hmpc::size{4}>([&](auto i)
+        {
+            REQUIRE(param.key[i] == key[i]);
+        });
+        hmpc::iter::for_range<hmpc::size{3}>([&](auto i)
+        {
+            REQUIRE(param.nonce[i] == nonce[i]);
+        });
+    }
+
+    SECTION("Hardware")
+    {
+#ifdef HMPC_HAS_AES_NI
+        if (__builtin_cpu_supports("aes"))
+        {
+            std::array<std::uint32_t, 4> key128 = {0x0302'0100, 0x0706'0504, 0x0b0a'0908, 0x0f0e'0d0c};
+            std::array<std::uint32_t, 8> key256 = {0x0302'0100, 0x0706'0504, 0x0b0a'0908, 0x0f0e'0d0c, 0x1312'1110, 0x1716'1514, 0x1b1a'1918, 0x1f1e'1d1c};
+            std::array<std::uint32_t, 4> plaintext = {0x3322'1100, 0x7766'5544, 0xbbaa'9988, 0xffee'ddcc};
+
+            hmpc::crypto::detail::aes_blocks<3> blocks128 = {plaintext, plaintext, plaintext};
+            hmpc::crypto::detail::aes_encrypt_hardware<10>(hmpc::crypto::detail::aes_expand_key(key128), blocks128);
+            for (auto const& block : blocks128)
+            {
+                REQUIRE(block == std::array<std::uint32_t, 4>{0xd8e0'c469, 0x3004'7b6a, 0x80b7'cdd8, 0x5ac5'b470});
+            }
+
+            hmpc::crypto::detail::aes_blocks<3> blocks256 = {plaintext, plaintext, plaintext};
+            hmpc::crypto::detail::aes_encrypt_hardware<14>(hmpc::crypto::detail::aes_expand_key(key256), blocks256);
+            for (auto const& block : blocks256)
+            {
+                REQUIRE(block == std::array<std::uint32_t, 4>{0xcab7'a28e, 0xbf45'6751, 0x9049'fcea, 0x8960'494b});
+            }
+        }
+        else
+        {
+            WARN("AES-NI is not supported by this CPU");
+        }
+#else
+        WARN("Compiled without AES-NI (see the host-tests-aes-ni target)");
+#endif
+    }
+
+    SECTION("Compile time and runtime agree")
+    {
+        constexpr auto compiletime_state = []()
+        {
+            hmpc::crypto::aes256_ctr aes({key, nonce, counter});
+            aes();
+            return aes();
+        }();
+
+        hmpc::crypto::aes256_ctr aes({key, nonce, counter});
+        aes();
+        auto state = aes();
+
+        hmpc::iter::for_range<decltype(aes)::block_size>([&](auto i)
+        {
+            REQUIRE(state[i] == compiletime_state[i]);
+        });
+    }
+}
+
+TEST_CASE("AES-CTR engine", "[crypto][aes]")
+{
+    SECTION("Encryption")
+    {
+        hmpc::core::uint8 const plaintext_bytes[] = {0x4c, 0x61, 0x64, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x47, 0x65, 0x6e, 0x74, 0x6c, 0x65, 0x6d, 0x65, 0x6e};
+
+        hmpc::crypto::cipher<hmpc::crypto::aes128_ctr> aes({key, nonce, counter});
+
+        hmpc::core::uint8 ciphertext_bytes[20] = {};
+        aes.enc(
+            hmpc::core::limb_span<20, hmpc::core::uint8, hmpc::access::write_tag>{ciphertext_bytes},
+            hmpc::core::limb_span<20, hmpc::core::uint8, hmpc::access::read_tag>{plaintext_bytes}
+        );
+
+        // the first 16 bytes are xored with the AES-128 test vector
+        CHECK(ciphertext_bytes[0] == 0x25); // 0x4c ^ 0x69
+        CHECK(ciphertext_bytes[15] == 0x36); // 0x6c ^ 0x5a
+
+        aes.param({key, nonce, counter});
+
+        hmpc::core::uint8 decrypted_bytes[20] = {};
+        aes.dec(
+            hmpc::core::limb_span<20, hmpc::core::uint8, hmpc::access::write_tag>{decrypted_bytes},
+            hmpc::core::limb_span<20, hmpc::core::uint8, hmpc::access::read_tag>{ciphertext_bytes}
+        );
+
+        for (hmpc::size i = 0; i < 20; ++i)
+        {
+            CHECK(decrypted_bytes[i] == plaintext_bytes[i]);
+        }
+    }
+
+    SECTION("Sampling")
+    {
+        using namespace hmpc::ints::literals;
+        constexpr auto p = 0x2faeadbe7a0195c011ac195ad10269830e8001_int;
+        using mod_p = hmpc::ints::mod<p>;
+
+        hmpc::random::number_generator<hmpc::crypto::aes128_ctr> rng({key, nonce, counter});
+
+        for (int i = 0; i < 1'000; ++i)
+        {
+            auto x = hmpc::random::uniform<mod_p>(rng);
+            REQUIRE(x.modulus == p);
+
+            auto b = hmpc::random::binomial<10>(rng);
+            CHECK(b <= hmpc::ints::ubigint<4>{10});
+        }
+    }
+}
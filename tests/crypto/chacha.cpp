@@ -195,3 +195,34 @@ TEST_CASE("ChaCha 20", "[crypto][chacha]")
         REQUIRE(state[15] == 0x6ded'1b53);
     }
 }
+
+TEST_CASE("Multi-block ChaCha 20", "[crypto][chacha]")
+{
+    hmpc::core::uint32 const key[] = {0x0302'0100, 0x0706'0504, 0x0b0a'0908, 0x0f0e'0d0c, 0x1312'1110, 0x1716'1514, 0x1b1a'1918, 0x1f1e'1d1c};
+    hmpc::core::uint32 const nonce[] = {0x0900'0000, 0x4a00'0000, 0x0000'0000};
+    hmpc::core::uint32 const counter[] = {0xffff'fffe};
+
+    hmpc::iter::for_range<hmpc::size{4}>([&](auto i)
+    {
+        constexpr hmpc::size blocks = hmpc::size{1} << i;
+
+        hmpc::crypto::chacha20 chacha({key, nonce, counter});
+        hmpc::crypto::multi_chacha20<blocks> multi_chacha({key, nonce, counter});
+
+        // keystream equals consecutive single blocks (including the counter wrap-around)
+        for (int n = 0; n < 3; ++n)
+        {
+            auto multi_state = multi_chacha();
+            hmpc::iter::for_range<blocks>([&](auto l)
+            {
+                auto state = chacha();
+                hmpc::iter::for_range<hmpc::size{16}>([&](auto j)
+                {
+                    REQUIRE(multi_state[l * 16 + j] == state[j]);
+                });
+            });
+        }
+
+        REQUIRE(multi_chacha.param().counter[hmpc::constants::zero] == chacha.param().counter[hmpc::constants::zero]);
+    });
+}
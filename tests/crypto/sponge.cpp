@@ -0,0 +1,75 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/crypto/sponge.hpp>
+
+#include <array>
+#include <span>
+
+// Known answers computed with an independent reference implementation of the sponge (checked against the quarter round test vector of RFC 8439)
+
+TEST_CASE("ChaCha sponge", "[crypto][sponge]")
+{
+    using sponge_type = hmpc::crypto::chacha_sponge<>;
+    using word = sponge_type::value_type;
+
+    auto check = [](sponge_type::digest_type const& digest, std::array<word::underlying_type, sponge_type::digest_size> const& expected)
+    {
+        for (hmpc::size i = 0; i < sponge_type::digest_size; ++i)
+        {
+            REQUIRE(digest[i] == expected[i]);
+        }
+    };
+
+    SECTION("Empty message")
+    {
+        sponge_type sponge;
+        check(sponge.digest(), {0x3466'e53e, 0xac4c'2870, 0x892b'30ea, 0x32e8'3933, 0x08c4'2341, 0x515d'db0c, 0x7d70'3478, 0xd6e5'8a8c});
+    }
+
+    SECTION("Partial block")
+    {
+        sponge_type sponge;
+        for (word::underlying_type i = 0; i < 3; ++i)
+        {
+            sponge.absorb(word{i});
+        }
+        check(sponge.digest(), {0x4cdb'5523, 0x192b'b616, 0x1661'f2a6, 0xee47'f080, 0xab17'd77a, 0x40e0'df05, 0x2951'6344, 0x6946'2b60});
+    }
+
+    SECTION("Full block")
+    {
+        sponge_type sponge;
+        for (word::underlying_type i = 0; i < sponge_type::rate; ++i)
+        {
+            sponge.absorb(word{i});
+        }
+        check(sponge.digest(), {0x6475'2fa2, 0xa44e'4b10, 0x65ae'3efa, 0xfd5e'2ecf, 0x6586'dc97, 0x97bc'326f, 0xb876'b853, 0xdf61'aeb8});
+    }
+
+    SECTION("Reduced rounds")
+    {
+        hmpc::crypto::chacha_sponge<8> sponge;
+        check(sponge.digest(), {0x128b'3531, 0x4679'8636, 0x50e0'1b90, 0xf9a5'9d0d, 0x781a'172f, 0x1b0c'6091, 0xba34'3f01, 0x0569'319b});
+    }
+
+    SECTION("Wide limbs")
+    {
+        hmpc::core::uint64 const limbs[] = {0x0000'0001'0000'0000, 0x0000'0003'0000'0002};
+
+        sponge_type wide;
+        wide.absorb(std::span<hmpc::core::uint64 const>(limbs));
+
+        sponge_type narrow;
+        for (word::underlying_type i = 0; i < 4; ++i)
+        {
+            narrow.absorb(word{i});
+        }
+
+        auto expected = narrow.digest();
+        auto digest = wide.digest();
+        for (hmpc::size i = 0; i < sponge_type::digest_size; ++i)
+        {
+            REQUIRE(digest[i] == expected[i]);
+        }
+    }
+}
@@ -1,9 +1,18 @@
 #include "catch_helpers.hpp"
 
 #include <hmpc/comp/queue.hpp>
+#include <hmpc/crypto/aes.hpp>
 #include <hmpc/expr/crypto/cipher.hpp>
+#include <hmpc/expr/random/uniform.hpp>
 #include <hmpc/expr/tensor.hpp>
 #include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
+
+#include <array>
+#include <cstdint>
+#include <set>
+#include <span>
 
 TEST_CASE("Ciphers", "[expr][crypto][cipher]")
 {
@@ -63,3 +72,146 @@ TEST_CASE("Ciphers", "[expr][crypto][cipher]")
         }
     }
 }
+
+TEST_CASE("Ciphers with multi-block engines", "[expr][crypto][cipher]")
+{
+    using uint = hmpc::ints::ubigint<127>;
+    using limb = uint::limb_type;
+    using single_engine = hmpc::crypto::chacha20;
+    using multi_engine = hmpc::crypto::multi_chacha20<4>;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    // multiple batches of both engines
+    auto shape = hmpc::shape{100};
+
+    auto x = hmpc::comp::make_tensor<uint>(shape);
+    {
+        hmpc::comp::host_accessor x_access(x, hmpc::access::discard_write);
+        for (hmpc::size i = 0; i < shape.size(); ++i)
+        {
+            x_access[i] = hmpc::ints::num::bit_copy<uint>(hmpc::core::size_limb_span<limb>{i});
+        }
+    }
+
+    hmpc::core::limb_array<single_engine::key_size, limb> key = {42};
+    hmpc::core::limb_array<single_engine::nonce_size, limb> nonce = {1};
+
+    auto single_cipher = hmpc::expr::crypto::cipher<single_engine>(key.span(hmpc::access::read), nonce.span(hmpc::access::read));
+    auto multi_cipher = hmpc::expr::crypto::cipher<multi_engine>(key.span(hmpc::access::read), nonce.span(hmpc::access::read));
+
+    auto [y_single, y_multi] = queue(
+        hmpc::expr::crypto::enc(single_cipher, hmpc::expr::tensor(x)),
+        hmpc::expr::crypto::enc(multi_cipher, hmpc::expr::tensor(x))
+    );
+
+    // the keystream of multi_chacha is the keystream of chacha, so batches must not reuse counters of other batches
+    {
+        hmpc::comp::host_accessor single_access(y_single, hmpc::access::read);
+        hmpc::comp::host_accessor multi_access(y_multi, hmpc::access::read);
+        for (hmpc::size i = 0; i < y_single.shape().size(); ++i)
+        {
+            CHECK(single_access[i] == multi_access[i]);
+        }
+    }
+
+    auto x_again = queue(hmpc::expr::crypto::dec<uint>(multi_cipher, hmpc::expr::tensor(y_multi)));
+    {
+        hmpc::comp::host_accessor x_access(x_again, hmpc::access::read);
+        for (hmpc::size i = 0; i < shape.size(); ++i)
+        {
+            CHECK(x_access[i] == hmpc::ints::num::bit_copy<uint>(hmpc::core::size_limb_span<limb>{i}));
+        }
+    }
+}
+
+TEST_CASE("AES-CTR through expressions", "[expr][crypto][cipher][aes]")
+{
+    using uint = hmpc::ints::ubigint<127>;
+    using limb = uint::limb_type;
+    using engine = hmpc::crypto::aes128_ctr;
+    using single_block_engine = hmpc::crypto::aes_ctr<4, 3, 1, 1>;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    hmpc::core::limb_array<engine::key_size, limb> key = {42};
+    hmpc::core::limb_array<engine::nonce_size, limb> nonce = {1};
+
+    SECTION("Encryption")
+    {
+        auto shape = hmpc::shape{100};
+
+        auto x = hmpc::comp::make_tensor<uint>(shape);
+        auto zero = hmpc::comp::make_tensor<uint>(shape);
+        {
+            hmpc::comp::host_accessor x_access(x, hmpc::access::discard_write);
+            hmpc::comp::host_accessor zero_access(zero, hmpc::access::discard_write);
+            for (hmpc::size i = 0; i < shape.size(); ++i)
+            {
+                x_access[i] = hmpc::ints::num::bit_copy<uint>(hmpc::core::size_limb_span<limb>{i});
+                zero_access[i] = uint{};
+            }
+        }
+
+        auto cipher = hmpc::expr::crypto::cipher<engine>(key.span(hmpc::access::read), nonce.span(hmpc::access::read));
+        auto single_block_cipher = hmpc::expr::crypto::cipher<single_block_engine>(key.span(hmpc::access::read), nonce.span(hmpc::access::read));
+
+        auto [y, keystream, single_block_keystream] = queue(
+            hmpc::expr::crypto::enc(cipher, hmpc::expr::tensor(x)),
+            hmpc::expr::crypto::enc(cipher, hmpc::expr::tensor(zero)),
+            hmpc::expr::crypto::enc(single_block_cipher, hmpc::expr::tensor(zero))
+        );
+
+        {
+            hmpc::comp::host_accessor keystream_access(keystream, hmpc::access::read);
+            hmpc::comp::host_accessor single_block_access(single_block_keystream, hmpc::access::read);
+
+            // every AES block of the keystream is used once (a ubigint<127> is exactly one block)
+            std::set<std::array<std::uint32_t, 4>> blocks;
+            for (hmpc::size i = 0; i < shape.size(); ++i)
+            {
+                std::array<std::uint32_t, 4> block;
+                for (hmpc::size j = 0; j < 4; ++j)
+                {
+                    block[j] = keystream_access[4 * i + j].data;
+                    CHECK(keystream_access[4 * i + j] == single_block_access[4 * i + j]);
+                }
+                blocks.insert(block);
+            }
+            CHECK(blocks.size() == shape.size());
+        }
+
+        auto x_again = queue(hmpc::expr::crypto::dec<uint>(cipher, hmpc::expr::tensor(y)));
+        {
+            hmpc::comp::host_accessor x_access(x_again, hmpc::access::read);
+            for (hmpc::size i = 0; i < shape.size(); ++i)
+            {
+                CHECK(x_access[i] == hmpc::ints::num::bit_copy<uint>(hmpc::core::size_limb_span<limb>{i}));
+            }
+        }
+    }
+
+    SECTION("Queue random number generator")
+    {
+        using namespace hmpc::ints::literals;
+        // every element needs more than one AES block
+        using mod_p = hmpc::ints::mod<0x2faeadbe7a0195c011ac195ad10269830e8001_int>;
+        constexpr hmpc::size N = 100;
+
+        hmpc::comp::queue<hmpc::random::number_generator<engine>> aes_queue{sycl::queue(sycl::cpu_selector_v), std::span<limb const, engine::key_size>{key.data}};
+
+        auto r_tensor = aes_queue(hmpc::expr::random::uniform<mod_p>(hmpc::shape{N}));
+
+        hmpc::comp::host_accessor r(r_tensor, hmpc::access::read);
+        hmpc::core::limb_array<engine::nonce_size, limb> queue_nonce = {};
+        for (hmpc::size i = 0; i < N; ++i)
+        {
+            // element i starts at counter i * counters_per_call
+            hmpc::core::limb_array<engine::counter_size, limb> counter;
+            hmpc::ints::num::bit_copy(counter, hmpc::core::size_limb_span<limb>{i * engine::counters_per_call});
+            hmpc::random::number_generator<single_block_engine> rng({key.span(hmpc::access::read), queue_nonce.span(hmpc::access::read), counter.span(hmpc::access::read)});
+
+            CHECK(r[i] == hmpc::random::uniform<mod_p>(rng));
+        }
+    }
+}
@@ -70,4 +70,90 @@ TEST_CASE("Linear BGV", "[expr][crypto][lhe]")
     {
         CHECK(access[i] == hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i)));
     }
+
+    auto [dec_d, dec_e] = hmpc::expr::crypto::lhe::dec<plaintext>(hmpc::expr::tensor(s), hmpc::expr::crypto::lhe::ciphertext(d), hmpc::expr::crypto::lhe::ciphertext(e));
+    auto [y_d, y_e] = queue(dec_d, dec_e);
+    {
+        hmpc::comp::host_accessor d_access(y_d, hmpc::access::read);
+        hmpc::comp::host_accessor e_access(y_e, hmpc::access::read);
+        for (hmpc::size i : std::views::iota(hmpc::size{}, 4 * 2 * N))
+        {
+            CHECK(d_access[i] == hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(2 * i)));
+            CHECK(e_access[i] == hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(2 * i)));
+        }
+    }
+}
+
+TEST_CASE("Linear BGV with seed-compressed key", "[expr][crypto][lhe]")
+{
+    using namespace hmpc::ints::literals;
+
+    constexpr auto p = 0x8822'd806'2332'0001_int;                                                                     // 9809640459238244353
+    constexpr auto q = 0x59'1f5b'834c'0d96'1f67'343b'cc89'02bd'eda2'771f'5430'6ff1'5116'2ff8'd2b4'0f41'94dc'0001_int; // 676310504550516370745208338938566342426856908484397554505023779011987369401721290753
+    constexpr auto N = hmpc::size{1} << 12;
+
+    using Rq = hmpc::ints::poly_mod<q, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rq = hmpc::ints::traits::number_theoretic_transform_type_t<Rq>;
+    using mod_q = Rq::element_type;
+    using limb = mod_q::limb_type;
+
+    using Rp = hmpc::ints::poly_mod<p, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rp = hmpc::ints::traits::number_theoretic_transform_type_t<Rp>;
+    using mod_p = Rp::element_type;
+
+    using plaintext = ntt_Rp;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto shape = hmpc::shape{3};
+
+    auto b = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+    for (hmpc::comp::host_accessor access(b, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_q>(hmpc::core::size_limb_span<limb>(i));
+    }
+
+    auto compressed_k = hmpc::comp::crypto::lhe::compressed_key<ntt_Rq>{.seed = {42}, .b = b};
+
+    // the expanded `a` is the same every time (in separate calls and on other queues)
+    auto a = queue(hmpc::expr::crypto::lhe::seeded_a<ntt_Rq>(compressed_k.seed.span(hmpc::access::read)));
+    auto a_again = queue(hmpc::expr::crypto::lhe::seeded_a<ntt_Rq>(compressed_k.seed.span(hmpc::access::read)));
+    hmpc::comp::queue other_queue{sycl::queue(sycl::cpu_selector_v)};
+    auto a_elsewhere = other_queue(hmpc::expr::crypto::lhe::seeded_a<ntt_Rq>(compressed_k.seed.span(hmpc::access::read)));
+    {
+        hmpc::comp::host_accessor a_access(a, hmpc::access::read);
+        hmpc::comp::host_accessor a_again_access(a_again, hmpc::access::read);
+        hmpc::comp::host_accessor a_elsewhere_access(a_elsewhere, hmpc::access::read);
+        for (hmpc::size i : std::views::iota(hmpc::size{}, N))
+        {
+            CHECK(a_access[i] == a_again_access[i]);
+            CHECK(a_access[i] == a_elsewhere_access[i]);
+        }
+    }
+
+    auto k = hmpc::comp::crypto::lhe::key{a, b};
+
+    auto x = hmpc::comp::make_tensor<plaintext>(shape);
+    for (hmpc::comp::host_accessor access(x, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, 3 * N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i));
+    }
+
+    auto r = queue(hmpc::expr::crypto::lhe::randomness<Rq>(shape));
+
+    auto [c, expected] = queue(
+        hmpc::expr::crypto::lhe::enc(hmpc::expr::crypto::lhe::key(compressed_k), hmpc::expr::tensor(x), hmpc::expr::crypto::lhe::randomness(r)),
+        hmpc::expr::crypto::lhe::enc(hmpc::expr::crypto::lhe::key(k), hmpc::expr::tensor(x), hmpc::expr::crypto::lhe::randomness(r))
+    );
+    {
+        hmpc::comp::host_accessor c0_access(c.c0, hmpc::access::read);
+        hmpc::comp::host_accessor c1_access(c.c1, hmpc::access::read);
+        hmpc::comp::host_accessor expected_c0_access(expected.c0, hmpc::access::read);
+        hmpc::comp::host_accessor expected_c1_access(expected.c1, hmpc::access::read);
+        for (hmpc::size i : std::views::iota(hmpc::size{}, 3 * N))
+        {
+            CHECK(c0_access[i] == expected_c0_access[i]);
+            CHECK(c1_access[i] == expected_c1_access[i]);
+        }
+    }
 }
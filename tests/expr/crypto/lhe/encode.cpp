@@ -0,0 +1,112 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/comp/queue.hpp>
+#include <hmpc/expr/crypto/lhe/dec.hpp>
+#include <hmpc/expr/crypto/lhe/enc.hpp>
+#include <hmpc/expr/crypto/lhe/encode.hpp>
+#include <hmpc/expr/crypto/lhe/plaintext.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/poly_mod.hpp>
+
+#include <ranges>
+
+TEST_CASE("Linear BGV slot packing", "[expr][crypto][lhe]")
+{
+    using namespace hmpc::ints::literals;
+
+    constexpr auto p = 0x8822'd806'2332'0001_int;                                                                     // 9809640459238244353
+    constexpr auto q = 0x59'1f5b'834c'0d96'1f67'343b'cc89'02bd'eda2'771f'5430'6ff1'5116'2ff8'd2b4'0f41'94dc'0001_int; // 676310504550516370745208338938566342426856908484397554505023779011987369401721290753
+    constexpr auto N = hmpc::size{1} << 12;
+
+    using Rq = hmpc::ints::poly_mod<q, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rq = hmpc::ints::traits::number_theoretic_transform_type_t<Rq>;
+    using mod_q = Rq::element_type;
+    using limb = mod_q::limb_type;
+
+    using Rp = hmpc::ints::poly_mod<p, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rp = hmpc::ints::traits::number_theoretic_transform_type_t<Rp>;
+    using mod_p = Rp::element_type;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto shape = hmpc::shape{3, N};
+
+    auto x = hmpc::comp::make_tensor<mod_p>(shape);
+    for (hmpc::comp::host_accessor access(x, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, 3 * N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i));
+    }
+    auto y = hmpc::comp::make_tensor<mod_p>(hmpc::shape{N});
+    for (hmpc::comp::host_accessor access(y, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(N - i));
+    }
+
+    SECTION("Round trip")
+    {
+        auto [packed, coeff_packed] = queue(
+            hmpc::expr::crypto::lhe::encode<ntt_Rp>(hmpc::expr::tensor(x)),
+            hmpc::expr::crypto::lhe::encode<Rp>(hmpc::expr::tensor(x))
+        );
+        REQUIRE(packed.shape().rank == 1);
+        REQUIRE(packed.shape().get(hmpc::constants::zero) == 3);
+
+        auto [x_again, x_from_coeff] = queue(
+            hmpc::expr::crypto::lhe::decode(hmpc::expr::tensor(packed)),
+            hmpc::expr::crypto::lhe::decode(hmpc::expr::tensor(coeff_packed))
+        );
+        REQUIRE(x_again.shape().rank == 2);
+        REQUIRE(x_again.shape().get(hmpc::constants::one) == N);
+
+        hmpc::comp::host_accessor x_again_access(x_again, hmpc::access::read);
+        hmpc::comp::host_accessor x_from_coeff_access(x_from_coeff, hmpc::access::read);
+        for (hmpc::size i : std::views::iota(hmpc::size{}, 3 * N))
+        {
+            CHECK(x_again_access[i] == hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i)));
+            CHECK(x_from_coeff_access[i] == hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i)));
+        }
+    }
+
+    SECTION("Slot-wise homomorphic operations")
+    {
+        auto a = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+        for (hmpc::comp::host_accessor access(a, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, N))
+        {
+            access[i] = hmpc::ints::num::bit_copy<mod_q>(hmpc::core::size_limb_span<limb>(i));
+        }
+        auto b = a;
+        auto s = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+        for (hmpc::comp::host_accessor access(s, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, N))
+        {
+            access[i] = hmpc::ints::integer_traits<mod_q>::one;
+        }
+
+        auto k = hmpc::comp::crypto::lhe::key{a, b};
+
+        auto c = queue(hmpc::expr::crypto::lhe::enc(
+            hmpc::expr::crypto::lhe::key(k),
+            hmpc::expr::crypto::lhe::encode<ntt_Rp>(hmpc::expr::tensor(x)),
+            hmpc::expr::crypto::lhe::randomness<Rq>(hmpc::shape{3})
+        ));
+
+        auto c_expr = hmpc::expr::crypto::lhe::ciphertext(c);
+        auto y_plaintext = hmpc::expr::crypto::lhe::plaintext<ntt_Rq>(hmpc::expr::crypto::lhe::encode<ntt_Rp>(hmpc::expr::tensor(y)));
+
+        auto [sum, product] = queue(c_expr + c_expr, c_expr * y_plaintext);
+
+        auto [z_sum, z_product] = queue(
+            hmpc::expr::crypto::lhe::decode(hmpc::expr::crypto::lhe::dec<ntt_Rp>(hmpc::expr::tensor(s), hmpc::expr::crypto::lhe::ciphertext(sum))),
+            hmpc::expr::crypto::lhe::decode(hmpc::expr::crypto::lhe::dec<ntt_Rp>(hmpc::expr::tensor(s), hmpc::expr::crypto::lhe::ciphertext(product)))
+        );
+
+        hmpc::comp::host_accessor sum_access(z_sum, hmpc::access::read);
+        hmpc::comp::host_accessor product_access(z_product, hmpc::access::read);
+        for (hmpc::size i : std::views::iota(hmpc::size{}, 3 * N))
+        {
+            auto x_i = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i));
+            auto y_i = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(N - i % N));
+            CHECK(sum_access[i] == x_i + x_i);
+            CHECK(product_access[i] == x_i * y_i);
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/comp/queue.hpp>
+#include <hmpc/expr/crypto/lhe/dec.hpp>
+#include <hmpc/expr/crypto/lhe/enc.hpp>
+#include <hmpc/expr/crypto/lhe/linear_combination.hpp>
+#include <hmpc/expr/crypto/lhe/plaintext.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/poly_mod.hpp>
+
+#include <ranges>
+
+TEST_CASE("Linear BGV: Matrix-vector product", "[expr][crypto][lhe]")
+{
+    using namespace hmpc::ints::literals;
+
+    constexpr auto p = 0x8822'd806'2332'0001_int;                                                                     // 9809640459238244353
+    constexpr auto q = 0x59'1f5b'834c'0d96'1f67'343b'cc89'02bd'eda2'771f'5430'6ff1'5116'2ff8'd2b4'0f41'94dc'0001_int; // 676310504550516370745208338938566342426856908484397554505023779011987369401721290753
+    constexpr auto N = hmpc::size{1} << 12;
+
+    using Rq = hmpc::ints::poly_mod<q, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rq = hmpc::ints::traits::number_theoretic_transform_type_t<Rq>;
+    using mod_q = Rq::element_type;
+    using limb = mod_q::limb_type;
+
+    using Rp = hmpc::ints::poly_mod<p, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rp = hmpc::ints::traits::number_theoretic_transform_type_t<Rp>;
+    using mod_p = Rp::element_type;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    constexpr hmpc::size rows = 3;
+    constexpr hmpc::size columns = 2;
+    auto vector_shape = hmpc::shape{hmpc::size_constant_of<columns>};
+    auto matrix_shape = hmpc::shape{rows, hmpc::size_constant_of<columns>};
+
+    auto a = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+    for (hmpc::comp::host_accessor access(a, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_q>(hmpc::core::size_limb_span<limb>(i));
+    }
+    auto b = a;
+    auto s = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+    for (hmpc::comp::host_accessor access(s, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, N))
+    {
+        access[i] = hmpc::ints::integer_traits<mod_q>::one;
+    }
+
+    auto k = hmpc::comp::crypto::lhe::key{a, b};
+
+    // x[j] has slots i + j
+    auto x = hmpc::comp::make_tensor<ntt_Rp>(vector_shape);
+    for (hmpc::comp::host_accessor access(x, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, columns * N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i % N + i / N));
+    }
+
+    // M[r, j] is the constant polynomial r + j + 1
+    auto m = hmpc::comp::make_tensor<Rp>(matrix_shape);
+    for (hmpc::comp::host_accessor access(m, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, rows * columns * N))
+    {
+        auto entry = i / N;
+        auto value = (i % N == 0) ? entry / columns + entry % columns + 1 : 0;
+        access[i] = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(value));
+    }
+
+    auto c = queue(hmpc::expr::crypto::lhe::enc(hmpc::expr::crypto::lhe::key(k), hmpc::expr::tensor(x), hmpc::expr::crypto::lhe::randomness<Rq>(vector_shape)));
+
+    auto product = hmpc::expr::crypto::lhe::matrix_vector_product(
+        hmpc::expr::crypto::lhe::plaintext<ntt_Rq>(hmpc::expr::tensor(m)),
+        hmpc::expr::crypto::lhe::ciphertext(c)
+    );
+
+    auto y = queue(hmpc::expr::crypto::lhe::dec<ntt_Rp>(hmpc::expr::tensor(s), product));
+    REQUIRE(y.shape().rank == 1);
+    REQUIRE(y.shape().get(hmpc::constants::zero) == rows);
+    for (hmpc::comp::host_accessor access(y, hmpc::access::read); hmpc::size i : std::views::iota(hmpc::size{}, rows * N))
+    {
+        auto r = i / N;
+        auto slot = i % N;
+        hmpc::size expected = 0;
+        for (hmpc::size j = 0; j < columns; ++j)
+        {
+            expected += (r + j + 1) * (slot + j);
+        }
+        CHECK(access[i] == hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(expected)));
+    }
+}
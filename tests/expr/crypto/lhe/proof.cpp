@@ -0,0 +1,107 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/comp/queue.hpp>
+#include <hmpc/expr/crypto/lhe/enc.hpp>
+#include <hmpc/expr/crypto/lhe/proof.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/poly_mod.hpp>
+
+#include <ranges>
+
+TEST_CASE("Linear BGV proof of plaintext knowledge", "[expr][crypto][lhe][proof]")
+{
+    using namespace hmpc::ints::literals;
+
+    constexpr auto p = 0x8822'd806'2332'0001_int;                                                                     // 9809640459238244353
+    constexpr auto q = 0x59'1f5b'834c'0d96'1f67'343b'cc89'02bd'eda2'771f'5430'6ff1'5116'2ff8'd2b4'0f41'94dc'0001_int; // 676310504550516370745208338938566342426856908484397554505023779011987369401721290753
+    constexpr auto N = hmpc::size{1} << 12;
+    constexpr hmpc::size batch_size = 4;
+    constexpr hmpc::size mask_count = 8;
+
+    using Rq = hmpc::ints::poly_mod<q, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rq = hmpc::ints::traits::number_theoretic_transform_type_t<Rq>;
+    using mod_q = Rq::element_type;
+    using limb = mod_q::limb_type;
+
+    using Rp = hmpc::ints::poly_mod<p, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rp = hmpc::ints::traits::number_theoretic_transform_type_t<Rp>;
+    using mod_p = Rp::element_type;
+
+    using plaintext = ntt_Rp;
+
+    using limits = hmpc::expr::crypto::lhe::proof_limits<plaintext, ntt_Rq, batch_size>;
+    // |centered_binomial| <= 2 * variance for the default variances of `randomness`
+    REQUIRE(limits::u_bound == hmpc::ints::ubigint<2, limb>{2});
+    REQUIRE(limits::v_bound == hmpc::ints::ubigint<5, limb>{21});
+    REQUIRE(limits::w_bound == hmpc::ints::ubigint<5, limb>{21});
+    using other_limits = hmpc::expr::crypto::lhe::proof_limits<plaintext, ntt_Rq, batch_size, hmpc::default_statistical_security, decltype(hmpc::constants::one), decltype(hmpc::constants::two), decltype(hmpc::constants::half)>;
+    REQUIRE(other_limits::u_bound == hmpc::ints::ubigint<2, limb>{3});
+    REQUIRE(other_limits::v_bound == hmpc::ints::ubigint<3, limb>{5});
+    REQUIRE(other_limits::w_bound == hmpc::ints::ubigint<2, limb>{2});
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto shape = hmpc::shape{hmpc::size_constant_of<batch_size>};
+
+    auto a = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+    for (hmpc::comp::host_accessor access(a, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_q>(hmpc::core::size_limb_span<limb>(i));
+    }
+    auto b = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+    for (hmpc::comp::host_accessor access(b, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_q>(hmpc::core::size_limb_span<limb>(N - i));
+    }
+
+    auto k = hmpc::comp::crypto::lhe::key{a, b};
+
+    auto x = hmpc::comp::make_tensor<plaintext>(shape);
+    for (hmpc::comp::host_accessor access(x, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, batch_size * N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i));
+    }
+
+    auto r = queue(hmpc::expr::crypto::lhe::randomness<Rq>(shape));
+    auto c = queue(hmpc::expr::crypto::lhe::enc(hmpc::expr::crypto::lhe::key(k), hmpc::expr::tensor(x), hmpc::expr::crypto::lhe::randomness(r)));
+
+    auto proof = hmpc::expr::crypto::lhe::prove<plaintext>(queue, k, x, r, c, mask_count);
+    REQUIRE(proof.z.shape().get(hmpc::constants::zero) == mask_count);
+
+    auto holds = [&](auto const& condition)
+    {
+        auto result = queue(hmpc::expr::all(condition));
+        hmpc::comp::host_accessor access(result, hmpc::access::read);
+        hmpc::bit value = access;
+        return hmpc::bool_cast(value);
+    };
+
+    SECTION("Witness")
+    {
+        // the ciphertexts are the encryption of the witness (x, r) that `prove` uses
+        CHECK(holds(hmpc::expr::crypto::lhe::enc(hmpc::expr::crypto::lhe::key(k), hmpc::expr::tensor(x), hmpc::expr::crypto::lhe::randomness(r)) == hmpc::expr::crypto::lhe::ciphertext(c)));
+        CHECK(holds(hmpc::expr::crypto::lhe::enc_lifted<plaintext>(hmpc::expr::crypto::lhe::key(k), hmpc::expr::crypto::lhe::plaintext<ntt_Rq>(hmpc::expr::tensor(x)), hmpc::expr::crypto::lhe::randomness(r)) == hmpc::expr::crypto::lhe::ciphertext(c)));
+        // fresh randomness is sampled inside `enc` and differs from `r`
+        CHECK_FALSE(holds(hmpc::expr::crypto::lhe::enc(hmpc::expr::crypto::lhe::key(k), hmpc::expr::tensor(x), hmpc::expr::crypto::lhe::randomness<Rq>(shape)) == hmpc::expr::crypto::lhe::ciphertext(c)));
+    }
+
+    SECTION("Honest prover")
+    {
+        CHECK(hmpc::expr::crypto::lhe::verify<plaintext>(queue, k, c, proof));
+    }
+
+    SECTION("Wrong response")
+    {
+        {
+            hmpc::comp::host_accessor access(proof.z, hmpc::access::read_write);
+            access[hmpc::size{0}] = access[hmpc::size{0}] + hmpc::ints::integer_traits<mod_q>::one;
+        }
+        CHECK_FALSE(hmpc::expr::crypto::lhe::verify<plaintext>(queue, k, c, proof));
+    }
+
+    SECTION("Different ciphertexts")
+    {
+        auto other_c = queue(hmpc::expr::crypto::lhe::enc(hmpc::expr::crypto::lhe::key(k), hmpc::expr::tensor(x), hmpc::expr::crypto::lhe::randomness<Rq>(shape)));
+        CHECK_FALSE(hmpc::expr::crypto::lhe::verify<plaintext>(queue, k, other_c, proof));
+    }
+}
@@ -0,0 +1,59 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/comp/accessor.hpp>
+#include <hmpc/comp/queue.hpp>
+#include <hmpc/comp/tensor.hpp>
+#include <hmpc/expr/binary_expression.hpp>
+#include <hmpc/expr/invert.hpp>
+#include <hmpc/expr/tensor.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
+
+TEST_CASE("Inversion", "[expr][invert]")
+{
+    using namespace hmpc::expr::operators;
+    using namespace hmpc::ints::literals;
+
+    constexpr auto N = 37;
+    constexpr auto p = 0x2faeadbe7a0195c011ac195ad10269830e8001_int;
+    using mod_p = hmpc::ints::mod<p>;
+    using integer = mod_p::unsigned_type;
+    using limb = mod_p::limb_type;
+
+    auto x_tensor = hmpc::comp::make_tensor<mod_p>(hmpc::shape{N});
+
+    {
+        hmpc::comp::host_accessor access_x(x_tensor, hmpc::access::discard_write);
+
+        for (hmpc::size i = 0; i < N; ++i)
+        {
+            access_x[i] = mod_p(integer{static_cast<limb>(i % 5 == 0 ? 0 : 3 * i + 1)});
+        }
+    }
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto x = hmpc::expr::tensor(x_tensor);
+
+    auto [inverse_tensor, batch_inverse_tensor, product_tensor] = queue(
+        hmpc::expr::invert(x),
+        hmpc::expr::batch_invert<8>(x),
+        x * hmpc::expr::batch_invert(x)
+    );
+
+    hmpc::comp::host_accessor access_x(x_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor inverse(inverse_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor batch_inverse(batch_inverse_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor product(product_tensor, hmpc::access::read);
+
+    auto zero = mod_p(0_int);
+    auto one = mod_p(1_int);
+    for (hmpc::size i = 0; i < N; ++i)
+    {
+        mod_p value = access_x[i];
+        mod_p expected = (i % 5 == 0) ? zero : one;
+        CHECK(value * inverse[i] == expected);
+        CHECK(batch_inverse[i] == inverse[i]);
+        CHECK(product[i] == expected);
+    }
+}
@@ -5,6 +5,11 @@
 #include <hmpc/expr/matrix_product.hpp>
 #include <hmpc/expr/tensor.hpp>
 #include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
+#include <hmpc/ints/poly_mod.hpp>
+
+#include <ranges>
 
 TEST_CASE("Matrix product", "[expr][matmul]")
 {
@@ -117,3 +122,158 @@ TEST_CASE("Matrix product", "[expr][matmul]")
         CHECK(z[hmpc::index{1, 1, 3}] == result_uint{30});
     }
 }
+
+TEST_CASE("Tiled matrix product", "[expr][matmul]")
+{
+    using namespace hmpc::ints::literals;
+    using mod = hmpc::ints::mod<0x8822'd806'2332'0001_int>;
+    using limb = mod::limb_type;
+
+    // neither the output nor the sum dimension is a multiple of the tile size
+    auto x_shape = hmpc::shape{2, 37, hmpc::size_constant_of<45>};
+    auto y_shape = hmpc::shape{2, hmpc::size_constant_of<45>, 29};
+
+    auto x_tensor = hmpc::comp::make_tensor<mod>(x_shape);
+    for (hmpc::comp::host_accessor x(x_tensor, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, x_shape.size()))
+    {
+        x[i] = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(i * i + 1));
+    }
+    auto y_tensor = hmpc::comp::make_tensor<mod>(y_shape);
+    for (hmpc::comp::host_accessor y(y_tensor, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, y_shape.size()))
+    {
+        y[i] = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(3 * i + 2));
+    }
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto x = hmpc::expr::tensor(x_tensor);
+    auto y = hmpc::expr::tensor(y_tensor);
+
+    auto tiled = hmpc::expr::matrix_product(x, y);
+    STATIC_REQUIRE(hmpc::complex_expression<decltype(tiled)>);
+
+    auto [z_tensor, expected_tensor] = queue(tiled, hmpc::expr::matrix_product_expression<decltype(x), decltype(y)>{x, y});
+    auto z_shape = z_tensor.shape();
+    REQUIRE(z_shape.rank == 3);
+    REQUIRE(z_shape.get(hmpc::constants::zero) == 2);
+    REQUIRE(z_shape.get(hmpc::constants::one) == 37);
+    REQUIRE(z_shape.get(hmpc::constants::two) == 29);
+
+    hmpc::comp::host_accessor z(z_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor expected(expected_tensor, hmpc::access::read);
+    for (hmpc::size i = 0; i < z_shape.size(); ++i)
+    {
+        CHECK(z[i] == expected[i]);
+    }
+}
+
+TEST_CASE("Matrix product with dynamic sum dimension", "[expr][matmul]")
+{
+    using namespace hmpc::ints::literals;
+    using mod = hmpc::ints::mod<0x8822'd806'2332'0001_int>;
+    using limb = mod::limb_type;
+
+    hmpc::size rows = 19;
+    hmpc::size columns = 21;
+    hmpc::size extent = 100;
+
+    auto x_tensor = hmpc::comp::make_tensor<mod>(hmpc::shape{rows, extent});
+    for (hmpc::comp::host_accessor x(x_tensor, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, rows * extent))
+    {
+        x[i] = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(i * i + 1));
+    }
+    auto y_tensor = hmpc::comp::make_tensor<mod>(hmpc::shape{extent, columns});
+    for (hmpc::comp::host_accessor y(y_tensor, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, extent * columns))
+    {
+        y[i] = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(3 * i + 2));
+    }
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto z_tensor = queue(hmpc::expr::matrix_product(hmpc::expr::tensor(x_tensor), hmpc::expr::tensor(y_tensor)));
+
+    hmpc::comp::host_accessor x(x_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor y(y_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor z(z_tensor, hmpc::access::read);
+    for (hmpc::size i = 0; i < rows; ++i)
+    {
+        for (hmpc::size j = 0; j < columns; ++j)
+        {
+            mod expected = {};
+            for (hmpc::size k = 0; k < extent; ++k)
+            {
+                expected += x[i * extent + k] * y[k * columns + j];
+            }
+            CHECK(z[i * columns + j] == expected);
+        }
+    }
+}
+
+TEST_CASE("Blocked matrix product of polynomials", "[expr][matmul]")
+{
+    using namespace hmpc::ints::literals;
+    constexpr auto p = 0x8822'd806'2332'0001_int;
+    constexpr auto N = hmpc::size{16};
+    using poly = hmpc::ints::traits::number_theoretic_transform_type_t<hmpc::ints::poly_mod<p, N, hmpc::ints::coefficient_representation>>;
+    using mod = poly::element_type;
+    using limb = mod::limb_type;
+
+    // the sum dimension is larger than `max_unrolled_contraction_extent`
+    constexpr hmpc::size rows = 3;
+    constexpr hmpc::size columns = 2;
+    constexpr hmpc::size extent = 70;
+    STATIC_REQUIRE(extent > hmpc::expr::max_unrolled_contraction_extent);
+
+    auto x_tensor = hmpc::comp::make_tensor<poly>(hmpc::shape{rows, hmpc::size_constant_of<extent>});
+    auto x_dynamic_tensor = hmpc::comp::make_tensor<poly>(hmpc::shape{rows, extent});
+    {
+        hmpc::comp::host_accessor x(x_tensor, hmpc::access::discard_write);
+        hmpc::comp::host_accessor x_dynamic(x_dynamic_tensor, hmpc::access::discard_write);
+        for (hmpc::size i = 0; i < rows * extent * N; ++i)
+        {
+            auto value = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(i * i + 1));
+            x[i] = value;
+            x_dynamic[i] = value;
+        }
+    }
+    auto y_tensor = hmpc::comp::make_tensor<poly>(hmpc::shape{hmpc::size_constant_of<extent>, columns});
+    auto y_dynamic_tensor = hmpc::comp::make_tensor<poly>(hmpc::shape{extent, columns});
+    {
+        hmpc::comp::host_accessor y(y_tensor, hmpc::access::discard_write);
+        hmpc::comp::host_accessor y_dynamic(y_dynamic_tensor, hmpc::access::discard_write);
+        for (hmpc::size i = 0; i < extent * columns * N; ++i)
+        {
+            auto value = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(3 * i + 2));
+            y[i] = value;
+            y_dynamic[i] = value;
+        }
+    }
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto x = hmpc::expr::tensor(x_tensor);
+    auto y = hmpc::expr::tensor(y_tensor);
+
+    auto blocked = hmpc::expr::matrix_product(x, y);
+    STATIC_REQUIRE(std::same_as<decltype(blocked), hmpc::expr::blocked_matrix_product_expression<decltype(x), decltype(y)>>);
+    // products of polynomials in NTT representation are accumulated coefficient-wise
+    STATIC_REQUIRE(decltype(blocked)::use_product_accumulator);
+
+    auto blocked_dynamic = hmpc::expr::matrix_product(hmpc::expr::tensor(x_dynamic_tensor), hmpc::expr::tensor(y_dynamic_tensor));
+    STATIC_REQUIRE(decltype(blocked_dynamic)::sum_extent == hmpc::dynamic_extent);
+
+    auto [z_tensor, z_dynamic_tensor, expected_tensor] = queue(
+        blocked,
+        blocked_dynamic,
+        hmpc::expr::matrix_product_expression<decltype(x), decltype(y)>{x, y}
+    );
+
+    hmpc::comp::host_accessor z(z_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor z_dynamic(z_dynamic_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor expected(expected_tensor, hmpc::access::read);
+    for (hmpc::size i = 0; i < rows * columns * N; ++i)
+    {
+        CHECK(z[i] == expected[i]);
+        CHECK(z_dynamic[i] == expected[i]);
+    }
+}
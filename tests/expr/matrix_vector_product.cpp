@@ -6,6 +6,10 @@
 #include <hmpc/expr/matrix_vector_product.hpp>
 #include <hmpc/expr/tensor.hpp>
 #include <hmpc/ints/bigint.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
+
+#include <ranges>
 
 TEST_CASE("Matrix-vector multiplication of polynomials", "[expr][matmul][poly]")
 {
@@ -163,3 +167,51 @@ TEST_CASE("Matrix-vector multiplication of polynomials", "[expr][matmul][poly]")
         CHECK(z[hmpc::index{1, 1, 7}] == integer{195});
     }
 }
+
+TEST_CASE("Matrix-vector multiplication with dynamic sum dimension", "[expr][matmul]")
+{
+    using namespace hmpc::ints::literals;
+    using mod = hmpc::ints::mod<0x8822'd806'2332'0001_int>;
+    using limb = mod::limb_type;
+
+    hmpc::size rows = 5;
+    hmpc::size extent = 100;
+
+    auto m_tensor = hmpc::comp::make_tensor<mod>(hmpc::shape{3, rows, extent});
+    for (hmpc::comp::host_accessor m(m_tensor, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, 3 * rows * extent))
+    {
+        m[i] = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(i * i + 1));
+    }
+    auto x_tensor = hmpc::comp::make_tensor<mod>(hmpc::shape{3, extent});
+    for (hmpc::comp::host_accessor x(x_tensor, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, 3 * extent))
+    {
+        x[i] = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(3 * i + 2));
+    }
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto product = hmpc::expr::matrix_vector_product(hmpc::expr::tensor(m_tensor), hmpc::expr::tensor(x_tensor));
+    STATIC_REQUIRE(hmpc::complex_expression<decltype(product)>);
+
+    auto z_tensor = queue(product);
+    auto z_shape = z_tensor.shape();
+    REQUIRE(z_shape.rank == 2);
+    REQUIRE(z_shape.get(hmpc::constants::zero) == 3);
+    REQUIRE(z_shape.get(hmpc::constants::one) == rows);
+
+    hmpc::comp::host_accessor m(m_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor x(x_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor z(z_tensor, hmpc::access::read);
+    for (hmpc::size b = 0; b < 3; ++b)
+    {
+        for (hmpc::size i = 0; i < rows; ++i)
+        {
+            mod expected = {};
+            for (hmpc::size k = 0; k < extent; ++k)
+            {
+                expected += m[(b * rows + i) * extent + k] * x[b * extent + k];
+            }
+            CHECK(z[b * rows + i] == expected);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/comp/accessor.hpp>
+#include <hmpc/comp/queue.hpp>
+#include <hmpc/comp/tensor.hpp>
+#include <hmpc/expr/pow.hpp>
+#include <hmpc/expr/tensor.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
+
+TEST_CASE("Exponentiation", "[expr][pow]")
+{
+    using namespace hmpc::ints::literals;
+
+    constexpr auto N = 20;
+    constexpr auto p = 0x2faeadbe7a0195c011ac195ad10269830e8001_int;
+    using mod_p = hmpc::ints::mod<p>;
+    using integer = mod_p::unsigned_type;
+    using exponent_integer = hmpc::ints::ubigint<70>;
+    using limb = mod_p::limb_type;
+
+    constexpr auto generator = mod_p(7_int);
+
+    auto x_tensor = hmpc::comp::make_tensor<mod_p>(hmpc::shape{N});
+    auto e_tensor = hmpc::comp::make_tensor<exponent_integer>(hmpc::shape{N});
+
+    {
+        hmpc::comp::host_accessor access_x(x_tensor, hmpc::access::discard_write);
+        hmpc::comp::host_accessor access_e(e_tensor, hmpc::access::discard_write);
+
+        for (hmpc::size i = 0; i < N; ++i)
+        {
+            access_x[i] = mod_p(integer{static_cast<limb>(3 * i + 2)});
+            access_e[i] = exponent_integer{static_cast<limb>(i * i), static_cast<limb>(i), static_cast<limb>(i % 3 == 0 ? 0x3f : 0)};
+        }
+    }
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto x = hmpc::expr::tensor(x_tensor);
+    auto e = hmpc::expr::tensor(e_tensor);
+
+    auto [power_tensor, fixed_base_power_tensor] = queue(
+        hmpc::expr::pow(x, e),
+        hmpc::expr::pow(hmpc::constant_of<generator>, e)
+    );
+
+    hmpc::comp::host_accessor access_x(x_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor access_e(e_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor power(power_tensor, hmpc::access::read);
+    hmpc::comp::host_accessor fixed_base_power(fixed_base_power_tensor, hmpc::access::read);
+
+    for (hmpc::size i = 0; i < N; ++i)
+    {
+        mod_p base = access_x[i];
+        exponent_integer exponent = access_e[i];
+        CHECK(power[i] == pow(base, exponent));
+        CHECK(fixed_base_power[i] == pow(generator, exponent));
+    }
+}
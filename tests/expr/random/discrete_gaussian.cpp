@@ -0,0 +1,67 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/comp/accessor.hpp>
+#include <hmpc/comp/queue.hpp>
+#include <hmpc/expr/random/discrete_gaussian.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
+
+#include <cmath>
+
+TEST_CASE("Discrete Gaussian expression", "[expr][random]")
+{
+    using namespace hmpc::ints::literals;
+
+    constexpr auto p = 0x8822'd806'2332'0001_int; // 9809640459238244353
+    constexpr auto N = hmpc::size{100'000};
+
+    using mod_p = hmpc::ints::mod<p>;
+    using integer = mod_p::unsigned_type;
+    using limb = mod_p::limb_type;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+    using rng = decltype(queue)::random_number_generator_type;
+
+    // checks that all samples are in [-tail, tail] (as `mod_p`) and returns their sample variance
+    auto variance_of = [](auto const& tensor, hmpc::size tail)
+    {
+        hmpc::comp::host_accessor x(tensor, hmpc::access::read);
+
+        auto offset = mod_p{integer{static_cast<limb>(tail)}};
+        auto max = integer{static_cast<limb>(2 * tail)};
+
+        double sum = 0;
+        double sum_of_squares = 0;
+        for (hmpc::size i = 0; i < N; ++i)
+        {
+            // x[i] + tail is in [0, 2 * tail]
+            auto shifted = static_cast<integer>(x[i] + offset);
+            REQUIRE(shifted <= max);
+
+            auto value = static_cast<double>(shifted.data[0].data) - static_cast<double>(tail);
+            sum += value;
+            sum_of_squares += value * value;
+        }
+
+        CHECK(std::abs(sum / N) < 0.1);
+        return sum_of_squares / N;
+    };
+
+    SECTION("Rational standard deviation")
+    {
+        using limits = hmpc::random::discrete_gaussian_limits<hmpc::rational_size{16, 5}, rng>; // sigma = 3.2
+
+        auto x_tensor = queue(hmpc::expr::random::discrete_gaussian<mod_p>(hmpc::shape{N}, hmpc::rational_size_constant_of<16, 5>));
+
+        CHECK(std::abs(variance_of(x_tensor, limits::tail) - 3.2 * 3.2) < 0.3);
+    }
+
+    SECTION("Integer standard deviation")
+    {
+        using limits = hmpc::random::discrete_gaussian_limits<hmpc::rational_size{3}, rng>;
+
+        auto x_tensor = queue(hmpc::expr::random::discrete_gaussian<mod_p>(hmpc::shape{N}, hmpc::size_constant_of<3>));
+
+        CHECK(std::abs(variance_of(x_tensor, limits::tail) - 3.0 * 3.0) < 0.3);
+    }
+}
@@ -2,11 +2,15 @@
 
 #include <hmpc/comp/queue.hpp>
 #include <hmpc/expr/binary_expression.hpp>
+#include <hmpc/expr/random/uniform.hpp>
 #include <hmpc/expr/random/uniform_from_number_generator.hpp>
 #include <hmpc/expr/tensor.hpp>
 #include <hmpc/ints/literals.hpp>
 #include <hmpc/ints/poly_mod.hpp>
 
+#include <algorithm>
+#include <span>
+
 TEST_CASE("Uniform from number generator", "[expr][random]")
 {
     using namespace hmpc::expr::operators;
@@ -62,3 +66,55 @@ TEST_CASE("Uniform from number generator", "[expr][random]")
         }
     }
 }
+
+TEST_CASE("Batched uniform with multi-block engine", "[expr][random]")
+{
+    using namespace hmpc::ints::literals;
+
+    constexpr auto p = 0x8822'd806'2332'0001_int; // 9809640459238244353
+    constexpr auto N = hmpc::size{1000};
+    constexpr hmpc::size blocks = 4;
+    constexpr hmpc::size batch_size = 16;
+
+    using mod_p = hmpc::ints::mod<p>;
+    using multi_engine = hmpc::crypto::multi_chacha20<blocks>;
+    using single_engine = hmpc::crypto::chacha20;
+    using limb = single_engine::value_type;
+
+    hmpc::core::limb_array<single_engine::key_size, limb> key = {42};
+    hmpc::core::limb_array<single_engine::nonce_size, limb> nonce = {};
+
+    SECTION("Number generator")
+    {
+        hmpc::core::limb_array<single_engine::counter_size, limb> counter = {7};
+        hmpc::random::number_generator<multi_engine> multi_rng({key.span(hmpc::access::read), nonce.span(hmpc::access::read), counter.span(hmpc::access::read)});
+        hmpc::random::number_generator<single_engine> single_rng({key.span(hmpc::access::read), nonce.span(hmpc::access::read), counter.span(hmpc::access::read)});
+
+        // the keystream of one call of multi_chacha equals `blocks` calls of chacha
+        for (hmpc::size i = 0; i < 10 * multi_engine::block_size; ++i)
+        {
+            REQUIRE(multi_rng.next() == single_rng.next());
+        }
+    }
+
+    SECTION("Queue")
+    {
+        hmpc::comp::queue<hmpc::random::number_generator<multi_engine>, batch_size> queue{sycl::queue(sycl::cpu_selector_v), std::span<limb const, single_engine::key_size>{key.data}};
+
+        auto r_tensor = queue(hmpc::expr::random::uniform<mod_p>(hmpc::shape{N}));
+
+        // every batch reserves one engine call per element, i.e., `batch_size * blocks` counters of chacha
+        hmpc::comp::host_accessor r(r_tensor, hmpc::access::read);
+        for (hmpc::size b = 0; b * batch_size < N; ++b)
+        {
+            hmpc::core::limb_array<single_engine::counter_size, limb> counter;
+            hmpc::ints::num::bit_copy(counter, hmpc::core::size_limb_span<limb>{b * batch_size * blocks});
+            hmpc::random::number_generator<single_engine> rng({key.span(hmpc::access::read), nonce.span(hmpc::access::read), counter.span(hmpc::access::read)});
+
+            for (hmpc::size i = b * batch_size; i < std::min((b + 1) * batch_size, N); ++i)
+            {
+                CHECK(r[i] == hmpc::random::uniform<mod_p>(rng));
+            }
+        }
+    }
+}
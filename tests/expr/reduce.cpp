@@ -6,8 +6,12 @@
 #include <hmpc/expr/binary_expression.hpp>
 #include <hmpc/expr/reduce.hpp>
 #include <hmpc/expr/tensor.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
 #include <hmpc/ints/uint.hpp>
 
+#include <ranges>
+
 TEST_CASE("Reduction", "[expr][reduce]")
 {
     using namespace hmpc::expr::operators;
@@ -117,3 +121,75 @@ TEST_CASE("Reduction", "[expr][reduce]")
         CHECK(value == uint{28});
     }
 }
+
+TEST_CASE("Reduction along an axis", "[expr][reduce]")
+{
+    using namespace hmpc::ints::literals;
+    using mod = hmpc::ints::mod<0x8822'd806'2332'0001_int>;
+    using limb = mod::limb_type;
+
+    // the summed extent is not a multiple of the work group size
+    constexpr hmpc::size rows = 7;
+    constexpr hmpc::size columns = 150;
+    auto shape = hmpc::shape{rows, hmpc::size_constant_of<columns>};
+
+    auto x_tensor = hmpc::comp::make_tensor<mod>(shape);
+    for (hmpc::comp::host_accessor x(x_tensor, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, shape.size()))
+    {
+        x[i] = hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(i * i + 1));
+    }
+    auto y_tensor = hmpc::comp::make_tensor<mod>(shape);
+    for (hmpc::comp::host_accessor y(y_tensor, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, shape.size()))
+    {
+        y[i] = (i % columns < 3 * (i / columns)) ? mod{} : hmpc::ints::num::bit_copy<mod>(hmpc::core::size_limb_span<limb>(i * i + 1));
+    }
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto x = hmpc::expr::tensor(x_tensor);
+    auto y = hmpc::expr::tensor(y_tensor);
+
+    auto row_sum = hmpc::expr::sum(x, hmpc::constants::minus_one);
+    STATIC_REQUIRE(hmpc::complex_expression<decltype(row_sum)>);
+    STATIC_REQUIRE(decltype(row_sum)::use_sum_accumulator);
+
+    auto [row_sum_tensor, column_sum_tensor, row_equal_tensor, column_equal_tensor] = queue(
+        row_sum,
+        hmpc::expr::sum(x, hmpc::constants::zero),
+        hmpc::expr::all(x == y, hmpc::constants::one),
+        hmpc::expr::all(x == y, hmpc::constants::zero)
+    );
+    REQUIRE(row_sum_tensor.shape().rank == 1);
+    REQUIRE(row_sum_tensor.shape().size() == rows);
+    REQUIRE(column_sum_tensor.shape().size() == columns);
+
+    hmpc::comp::host_accessor access_x(x_tensor, hmpc::access::read);
+    {
+        hmpc::comp::host_accessor row_sum(row_sum_tensor, hmpc::access::read);
+        hmpc::comp::host_accessor row_equal(row_equal_tensor, hmpc::access::read);
+        for (hmpc::size i = 0; i < rows; ++i)
+        {
+            mod expected = {};
+            for (hmpc::size j = 0; j < columns; ++j)
+            {
+                expected += access_x[i * columns + j];
+            }
+            CHECK(row_sum[i] == expected);
+            CHECK(row_equal[i] == hmpc::bit{i == 0});
+        }
+    }
+    {
+        hmpc::comp::host_accessor column_sum(column_sum_tensor, hmpc::access::read);
+        hmpc::comp::host_accessor column_equal(column_equal_tensor, hmpc::access::read);
+        for (hmpc::size j = 0; j < columns; ++j)
+        {
+            mod expected = {};
+            for (hmpc::size i = 0; i < rows; ++i)
+            {
+                expected += access_x[i * columns + j];
+            }
+            CHECK(column_sum[j] == expected);
+            CHECK(column_equal[j] == hmpc::bit{j >= 3 * (rows - 1)});
+        }
+    }
+}
@@ -5,6 +5,71 @@
 #include <hmpc/ints/literals.hpp>
 #include <hmpc/ints/mod.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <concepts>
+#include <string>
+
+namespace
+{
+    using namespace hmpc::ints::literals;
+
+    // pseudo-Mersenne primes (2^64 - 59, 2^128 - 159, and 2^256 - 189)
+#ifdef HMPC_HAS_UINT128
+    constexpr auto p64 = 0xffff'ffff'ffff'ffc5_int;
+#endif
+    constexpr auto p128 = 0xffff'ffff'ffff'ffff'ffff'ffff'ffff'ff61_int;
+    constexpr auto p256 = 0xffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff'ff43_int;
+
+    // generic primes of the same width
+    constexpr auto q128 = 0xc3a5'c85c'97cb'3127'b2b5'f0ad'1a6e'7f57_int;
+    constexpr auto q256 = 0xc3a5'c85c'97cb'3127'b2b5'f0ad'1a6e'7f4d'9e37'79b9'7f4a'7c15'f39c'c060'5ced'c84d_int;
+
+    template<auto Modulus>
+    void benchmark_multiply(std::string const& name)
+    {
+        using mod_p = hmpc::ints::mod<Modulus>;
+
+        auto x = mod_p(0x0123'4567'89ab'cdef'0123'4567'89ab'cdef_int);
+        auto y = mod_p(0xfedc'ba98'7654'3210'fedc'ba98'7654'3210_int);
+
+        BENCHMARK(name + " with " + std::to_string(mod_p::limb_type::bit_size) + "-bit limbs")
+        {
+            x = x * y;
+            return x;
+        };
+    }
+}
+
+#ifdef HMPC_HAS_UINT128
+// keep the default limbs for these moduli even with `HMPC_PREFER_WIDE_LIMBS` (see `hmpc::ints::traits::modulus_limb_type`)
+template<>
+struct hmpc::ints::traits::modulus_limb_type<p64>
+{
+    using type = hmpc::default_limb;
+};
+template<>
+struct hmpc::ints::traits::modulus_limb_type<p128>
+{
+    using type = hmpc::default_limb;
+};
+template<>
+struct hmpc::ints::traits::modulus_limb_type<p256>
+{
+    using type = hmpc::default_limb;
+};
+template<>
+struct hmpc::ints::traits::modulus_limb_type<q128>
+{
+    using type = hmpc::default_limb;
+};
+template<>
+struct hmpc::ints::traits::modulus_limb_type<q256>
+{
+    using type = hmpc::default_limb;
+};
+#endif
+
 TEST_CASE("Integers modulo")
 {
     using namespace hmpc::ints::literals;
@@ -79,6 +144,40 @@ TEST_CASE("Integers modulo")
         }
     }
 
+    SECTION("Inversion")
+    {
+        constexpr auto compiletime_inverse = invert(mod_p(512_int));
+        auto runtime_inverse = invert(fivetwelve);
+        REQUIRE(runtime_inverse == compiletime_inverse);
+        REQUIRE(fivetwelve * runtime_inverse == one);
+        REQUIRE(invert(zero) == zero);
+        REQUIRE(invert(one) == one);
+        REQUIRE(pow(fivetwelve, hmpc::constant_of<5_int>) == pow(fivetwelve, hmpc::size_constant_of<5>));
+        REQUIRE(pow(fivetwelve, hmpc::constant_of<0_int>) == one);
+        REQUIRE(pow(fivetwelve, mod_p::inverse_exponent) * fivetwelve == one);
+    }
+
+    SECTION("Runtime exponent")
+    {
+        constexpr auto e = 0x1f3a5c7e9b2d4f6a8c0e1d3b5f7a9c_int;
+        constexpr auto compiletime_power = pow(mod_p(512_int), e);
+        auto exponent = e;
+        REQUIRE(pow(fivetwelve, exponent) == compiletime_power);
+        REQUIRE(pow<1>(fivetwelve, exponent) == compiletime_power);
+        REQUIRE(pow<5>(fivetwelve, exponent) == compiletime_power);
+        REQUIRE(pow(fivetwelve, hmpc::ints::ubigint<1>{}) == one);
+        REQUIRE(pow(zero, exponent) == zero);
+    }
+
+    SECTION("Squaring")
+    {
+        auto minus_fivetwelve = -fivetwelve;
+        REQUIRE(square(fivetwelve) == fivetwelve * fivetwelve);
+        REQUIRE(square(minus_fivetwelve) == minus_fivetwelve * minus_fivetwelve);
+        REQUIRE(square(zero) == zero);
+        REQUIRE(square(one) == one);
+    }
+
     SECTION("Format")
     {
         REQUIRE(HMPC_FMTLIB::format("{}", zero) == "0x0000000000000000000000000000000000000000");
@@ -86,3 +185,226 @@ TEST_CASE("Integers modulo")
         REQUIRE(HMPC_FMTLIB::format("{}", fivetwelve) == "0x0000000000000000000000000000000000000200");
     }
 }
+
+TEST_CASE("Integers modulo structured moduli")
+{
+    using namespace hmpc::ints::literals;
+    using hmpc::ints::modulus_structure;
+
+    SECTION("Mersenne")
+    {
+        constexpr auto p = 0x7fffffffffffffffffffffffffffffff_int; // 2^127 - 1
+        using mod_p = hmpc::ints::mod<p>;
+        using limb = mod_p::limb_type;
+
+        STATIC_REQUIRE(mod_p::structure == modulus_structure::pseudo_mersenne);
+        STATIC_REQUIRE(hmpc::bool_cast(mod_p::inverse_modulus == hmpc::core::limb_traits<limb>::one));
+
+        auto one = mod_p(1_int);
+        auto two = mod_p(2_int);
+        auto minus_one = mod_p(-0x1_int);
+        REQUIRE(pow(two, hmpc::size_constant_of<127>) == one);
+        REQUIRE(minus_one * minus_one == one);
+        REQUIRE(minus_one + two == one);
+    }
+
+    SECTION("Pseudo-Mersenne")
+    {
+        constexpr auto p = 0x3fffffffffffffffffffffffffffffffb_int; // 2^130 - 5
+        using mod_p = hmpc::ints::mod<p>;
+        using integer = mod_p::unsigned_type;
+
+        STATIC_REQUIRE(mod_p::structure == modulus_structure::pseudo_mersenne);
+
+        auto two = mod_p(2_int);
+        REQUIRE(static_cast<integer>(pow(two, hmpc::size_constant_of<130>)) == 5_int);
+        REQUIRE(static_cast<integer>(mod_p(-0x1_int) * mod_p(-0x1_int)) == 1_int);
+    }
+
+    SECTION("Pseudo-Mersenne with full limbs")
+    {
+        using mod_p = hmpc::ints::mod<p128>;
+        using limb = mod_p::limb_type;
+        using integer = mod_p::unsigned_type;
+
+        STATIC_REQUIRE(mod_p::structure == modulus_structure::pseudo_mersenne);
+
+        constexpr auto a = 0x0123'4567'89ab'cdef'0123'4567'89ab'cdef_int;
+        constexpr auto b = 0xfedc'ba98'7654'3210'fedc'ba98'7654'3210_int;
+        REQUIRE(static_cast<integer>(mod_p(a) * mod_p(b)) == hmpc::ints::limb_cast<limb>((a * b) % p128));
+        REQUIRE(static_cast<integer>(square(mod_p(b))) == hmpc::ints::limb_cast<limb>((b * b) % p128));
+        REQUIRE(static_cast<integer>(mod_p(a * b)) == hmpc::ints::limb_cast<limb>((a * b) % p128));
+        REQUIRE(static_cast<integer>(pow(mod_p(2_int), hmpc::size_constant_of<128>)) == hmpc::ints::limb_cast<limb>(0x9f_int)); // 159
+    }
+
+    SECTION("Solinas")
+    {
+        constexpr auto p = 0xffffffff00000001_int; // 2^64 - 2^32 + 1
+        using mod_p = hmpc::ints::mod<p>;
+        using limb = mod_p::limb_type;
+        using integer = mod_p::unsigned_type;
+
+        STATIC_REQUIRE(mod_p::structure == modulus_structure::generic);
+        STATIC_REQUIRE(hmpc::bool_cast(mod_p::inverse_modulus == hmpc::core::limb_traits<limb>::max));
+
+        auto one = mod_p(1_int);
+        auto two = mod_p(2_int);
+        REQUIRE(pow(two, hmpc::size_constant_of<96>) == mod_p(-0x1_int));
+        REQUIRE(pow(two, hmpc::size_constant_of<192>) == one);
+        REQUIRE(static_cast<integer>(pow(two, hmpc::size_constant_of<64>)) == 0xffffffff_int);
+    }
+
+    SECTION("NTT-friendly")
+    {
+        constexpr auto p = 0x2b00000001_int; // 43 * 2^32 + 1
+        using mod_p = hmpc::ints::mod<p>;
+        using limb = mod_p::limb_type;
+        using integer = mod_p::unsigned_type;
+
+        STATIC_REQUIRE(mod_p::structure == modulus_structure::generic);
+        STATIC_REQUIRE(hmpc::bool_cast(mod_p::inverse_modulus == hmpc::core::limb_traits<limb>::max));
+
+        auto two = mod_p(2_int);
+        REQUIRE(static_cast<integer>(pow(two, hmpc::size_constant_of<38>)) == 0x14ffffffff_int); // 21 * 2^32 - 1
+        REQUIRE(static_cast<integer>(mod_p(-0x1_int) * mod_p(-0x1_int)) == 1_int);
+    }
+
+    SECTION("Generic")
+    {
+        STATIC_REQUIRE(hmpc::ints::mod<q128>::structure == modulus_structure::generic);
+        STATIC_REQUIRE(hmpc::ints::mod<0x2faeadbe7a0195c011ac195ad10269830e8001_int>::structure == modulus_structure::generic);
+    }
+}
+
+TEST_CASE("Integers modulo lazy accumulation")
+{
+    using namespace hmpc::ints::literals;
+
+    auto check = []<typename T, T Modulus, hmpc::size Terms>(hmpc::constant<T, Modulus>, hmpc::size_constant<Terms>)
+    {
+        using mod_p = hmpc::ints::mod<Modulus>;
+        using accumulator_type = hmpc::ints::mod_accumulator<Modulus, Terms>;
+
+        auto minus_one = mod_p(-0x1_int);
+        auto x = mod_p(0x2488b8649d2b26fd819b73b94e54ed3c8dc325_int);
+        auto y = mod_p(0x14777bad2b7e4321264fea92350db2982cfaa2_int);
+
+        accumulator_type accumulator;
+        auto expected = mod_p(0_int);
+        hmpc::iter::for_range<Terms>([&](auto i)
+        {
+            auto left = (i % 2 == 0) ? minus_one : x;
+            auto right = (i % 3 == 0) ? minus_one : y;
+            accumulator.multiply_add(left, right);
+            expected += left * right;
+        });
+        REQUIRE(accumulator.reduce() == expected);
+        return accumulator_type::auxiliary_power;
+    };
+
+    SECTION("Single reduction")
+    {
+        constexpr auto p = 0x2faeadbe7a0195c011ac195ad10269830e8001_int;
+        STATIC_REQUIRE(hmpc::ints::has_product_accumulator<hmpc::ints::mod<p>, 4>);
+        REQUIRE(check(hmpc::constant_of<p>, hmpc::size_constant_of<4>) == hmpc::ints::mod<p>::limb_size);
+        REQUIRE(check(hmpc::constant_of<p>, hmpc::size_constant_of<7>) == hmpc::ints::mod<p>::limb_size);
+    }
+
+    SECTION("Extra reduction")
+    {
+        constexpr auto p = 0x7fffffffffffffffffffffffffffffff_int; // 2^127 - 1
+        STATIC_REQUIRE(hmpc::ints::has_product_accumulator<hmpc::ints::mod<p>, 16>);
+        STATIC_REQUIRE(not hmpc::ints::has_product_accumulator<hmpc::ints::mod<p>, 1>);
+        REQUIRE(check(hmpc::constant_of<p>, hmpc::size_constant_of<2>) == hmpc::ints::mod<p>::limb_size + 1);
+        REQUIRE(check(hmpc::constant_of<p>, hmpc::size_constant_of<16>) == hmpc::ints::mod<p>::limb_size + 1);
+    }
+}
+
+#ifdef HMPC_HAS_UINT128
+TEST_CASE("Integers modulo with 64-bit limbs")
+{
+    using namespace hmpc::ints::literals;
+    using hmpc::ints::limb_cast;
+    using wide_limb = hmpc::core::uint64;
+
+    constexpr auto p = 0x2faeadbe7a0195c011ac195ad10269830e8001_int; // 1'063'351'684'119'354'455'646'439'919'975'158'459'206'107'137
+    constexpr auto wide_p = limb_cast<wide_limb>(p);
+
+    using mod_p = hmpc::ints::mod<p>;
+    using wide_mod_p = hmpc::ints::mod<wide_p>;
+    using wide_integer = wide_mod_p::unsigned_type;
+
+    STATIC_REQUIRE(mod_p::limb_size == 5);
+    STATIC_REQUIRE(wide_mod_p::limb_size == 3);
+    STATIC_REQUIRE(wide_mod_p::bit_size == mod_p::bit_size);
+
+    REQUIRE(limb_cast<hmpc::default_limb>(wide_p) == p);
+    REQUIRE(wide_mod_p::reduced_auxiliary_modulus == limb_cast<wide_limb>(0x38789058185640cf05ff370eee5ce485aed42_int)); // 2^192 mod p
+
+    auto a = 0x2488b8649d2b26fd819b73b94e54ed3c8dc325_int;
+    auto b = 0x14777bad2b7e4321264fea92350db2982cfaa2_int;
+
+    auto x = mod_p(a);
+    auto y = mod_p(b);
+    auto wide_x = wide_mod_p(limb_cast<wide_limb>(a));
+    auto wide_y = wide_mod_p(limb_cast<wide_limb>(b));
+
+    REQUIRE(static_cast<wide_integer>(wide_x) == limb_cast<wide_limb>(a));
+    REQUIRE(static_cast<wide_integer>(wide_x + wide_y) == limb_cast<wide_limb>(static_cast<mod_p::unsigned_type>(x + y)));
+    REQUIRE(static_cast<wide_integer>(wide_x - wide_y) == limb_cast<wide_limb>(static_cast<mod_p::unsigned_type>(x - y)));
+    REQUIRE(static_cast<wide_integer>(wide_y - wide_x) == limb_cast<wide_limb>(static_cast<mod_p::unsigned_type>(y - x)));
+    REQUIRE(static_cast<wide_integer>(wide_x * wide_y) == limb_cast<wide_limb>(static_cast<mod_p::unsigned_type>(x * y)));
+    REQUIRE(static_cast<wide_integer>(pow(wide_x, hmpc::size_constant_of<5>)) == limb_cast<wide_limb>(static_cast<mod_p::unsigned_type>(pow(x, hmpc::size_constant_of<5>))));
+    REQUIRE(static_cast<wide_integer>(wide_mod_p(limb_cast<wide_limb>(-0x1_int))) == limb_cast<wide_limb>(0x2faeadbe7a0195c011ac195ad10269830e8000_int)); // -1
+}
+#endif
+
+TEST_CASE("Integers modulo limb selection")
+{
+    using namespace hmpc::ints::literals;
+
+    constexpr auto p = 0x2faeadbe7a0195c011ac195ad10269830e8001_int;
+    using mod_p = hmpc::ints::mod<p>;
+    using limb = mod_p::limb_type;
+    using integer = mod_p::unsigned_type;
+
+    STATIC_REQUIRE(std::same_as<limb, hmpc::ints::traits::preferred_limb_type_t<decltype(p)::bit_size>>);
+    STATIC_REQUIRE(std::same_as<hmpc::ints::mod<0x7_int>::limb_type, hmpc::default_limb>);
+#ifndef HMPC_PREFER_WIDE_LIMBS
+    STATIC_REQUIRE(std::same_as<limb, hmpc::default_limb>);
+#endif
+
+    // literals (with default limbs) work for either limb type
+    REQUIRE(static_cast<integer>(mod_p(3_int) * mod_p(-0x5_int)) == hmpc::ints::limb_cast<limb>(0x2faeadbe7a0195c011ac195ad10269830e7ff2_int)); // -15
+
+#ifdef HMPC_HAS_UINT128
+    // explicit limbs are kept
+    STATIC_REQUIRE(std::same_as<hmpc::ints::mod<hmpc::ints::limb_cast<hmpc::core::uint64>(p)>::limb_type, hmpc::core::uint64>);
+
+    // opt-out (see the specializations above)
+    STATIC_REQUIRE(std::same_as<hmpc::ints::mod<p128>::limb_type, hmpc::default_limb>);
+#endif
+}
+
+#ifdef HMPC_HAS_UINT128
+TEST_CASE("Integers modulo benchmark", "[.][benchmark][ints][mod]")
+{
+    using hmpc::ints::limb_cast;
+    using wide_limb = hmpc::core::uint64;
+
+    benchmark_multiply<p64>("64-bit multiplication");
+    benchmark_multiply<limb_cast<wide_limb>(p64)>("64-bit multiplication");
+    benchmark_multiply<p128>("128-bit multiplication");
+    benchmark_multiply<limb_cast<wide_limb>(p128)>("128-bit multiplication");
+    benchmark_multiply<p256>("256-bit multiplication");
+    benchmark_multiply<limb_cast<wide_limb>(p256)>("256-bit multiplication");
+}
+#endif
+
+TEST_CASE("Integers modulo structured moduli benchmark", "[.][benchmark][ints][mod]")
+{
+    benchmark_multiply<p128>("128-bit pseudo-Mersenne multiplication");
+    benchmark_multiply<q128>("128-bit generic multiplication");
+    benchmark_multiply<p256>("256-bit pseudo-Mersenne multiplication");
+    benchmark_multiply<q256>("256-bit generic multiplication");
+}
@@ -102,4 +102,59 @@ TEST_CASE("Integer polynomials modulo", "[ints][poly][mod]")
             CHECK(x == z);
         }
     }
+
+    SECTION("Batched")
+    {
+        auto element_size = shape.size();
+        auto x2 = hmpc::comp::make_tensor<R>(shape);
+        {
+            hmpc::comp::host_accessor x_elements(x, hmpc::access::discard_write);
+            hmpc::comp::host_accessor x2_elements(x2, hmpc::access::discard_write);
+            for (hmpc::size j = 0; j < element_size; ++j)
+            {
+                for (hmpc::size i = 0; i < N; ++i)
+                {
+                    x_elements[index_type{j, i}] = mod{hmpc::ints::ubigint<32>{static_cast<limb>(i)}};
+                    x2_elements[index_type{j, i}] = mod{hmpc::ints::ubigint<32>{static_cast<limb>(N - i + j)}};
+                }
+            }
+        }
+
+        auto [y, y2] = hmpc::expr::batched_number_theoretic_transform(hmpc::expr::tensor(x), hmpc::expr::tensor(x2));
+        REQUIRE(y.shape().rank == 1);
+        REQUIRE(y.shape().get(hmpc::constants::zero) == 2);
+
+        auto [z, z2] = hmpc::expr::batched_inverse_number_theoretic_transform(y, y2);
+
+        auto [ntt_x, ntt_x2, expected_ntt_x2, x_again, x2_again] = queue(
+            y,
+            y2,
+            hmpc::expr::number_theoretic_transform(hmpc::expr::tensor(x2)),
+            z,
+            z2
+        );
+        REQUIRE(ntt_x.shape().rank == 1);
+        REQUIRE(ntt_x.shape().get(hmpc::constants::zero) == 2);
+        REQUIRE(x_again.shape().rank == 1);
+        REQUIRE(x_again.shape().get(hmpc::constants::zero) == 2);
+
+        hmpc::comp::host_accessor x_elements(x, hmpc::access::read);
+        hmpc::comp::host_accessor x2_elements(x2, hmpc::access::read);
+        hmpc::comp::host_accessor ntt_x_elements(ntt_x, hmpc::access::read);
+        hmpc::comp::host_accessor ntt_x2_elements(ntt_x2, hmpc::access::read);
+        hmpc::comp::host_accessor expected_ntt_x2_elements(expected_ntt_x2, hmpc::access::read);
+        hmpc::comp::host_accessor x_again_elements(x_again, hmpc::access::read);
+        hmpc::comp::host_accessor x2_again_elements(x2_again, hmpc::access::read);
+        for (hmpc::size j = 0; j < element_size; ++j)
+        {
+            REQUIRE(static_cast<integer>(static_cast<mod>(ntt_x_elements[index_type{j, 0}])) == 0x7bf0fe81e23706642244f0cf8fb65af112666_int); // same as above
+            REQUIRE(static_cast<integer>(static_cast<mod>(ntt_x_elements[index_type{j, 19}])) == 0x1cdb8c2cce3758d6acd87bf78549948e08faba_int);
+        }
+        for (hmpc::size i = 0; i < x.element_shape().size(); ++i)
+        {
+            CHECK(static_cast<mod>(ntt_x2_elements[i]) == static_cast<mod>(expected_ntt_x2_elements[i]));
+            CHECK(static_cast<mod>(x_again_elements[i]) == static_cast<mod>(x_elements[i]));
+            CHECK(static_cast<mod>(x2_again_elements[i]) == static_cast<mod>(x2_elements[i]));
+        }
+    }
 }
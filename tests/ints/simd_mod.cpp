@@ -0,0 +1,56 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/mod.hpp>
+#include <hmpc/ints/simd_mod.hpp>
+
+TEST_CASE("Lane-wise integers modulo", "[simd]")
+{
+    using namespace hmpc::ints::literals;
+
+    auto check = []<typename T, T Modulus>(hmpc::constant<T, Modulus>)
+    {
+        constexpr hmpc::size lanes = 8;
+        using mod_p = hmpc::ints::mod<Modulus>;
+        using simd_mod_p = hmpc::ints::simd_mod<Modulus, lanes>;
+        using integer = mod_p::unsigned_type;
+        using limb = mod_p::limb_type;
+
+        simd_mod_p x;
+        simd_mod_p y;
+        for (hmpc::size l = 0; l < lanes; ++l)
+        {
+            x.set(l, mod_p(integer{static_cast<limb>(3 * l + 1), static_cast<limb>(l)}) * mod_p(-0x1_int));
+            y.set(l, (l % 2 == 0) ? mod_p(0_int) : mod_p(integer{static_cast<limb>(7 * l), limb{0xffffffff}, static_cast<limb>(l)}));
+        }
+
+        auto sum = x + y;
+        auto difference = x - y;
+        auto reverse_difference = y - x;
+        auto product = x * y;
+        auto square = x * x;
+        for (hmpc::size l = 0; l < lanes; ++l)
+        {
+            REQUIRE(sum.get(l) == x.get(l) + y.get(l));
+            REQUIRE(difference.get(l) == x.get(l) - y.get(l));
+            REQUIRE(reverse_difference.get(l) == y.get(l) - x.get(l));
+            REQUIRE(product.get(l) == x.get(l) * y.get(l));
+            REQUIRE(square.get(l) == x.get(l) * x.get(l));
+        }
+    };
+
+    SECTION("Generic")
+    {
+        check(hmpc::constant_of<0x2faeadbe7a0195c011ac195ad10269830e8001_int>);
+    }
+
+    SECTION("Full limbs")
+    {
+        check(hmpc::constant_of<0x95d13129b10a9d6e4bfc74319391cce9_int>);
+    }
+
+    SECTION("Mersenne")
+    {
+        check(hmpc::constant_of<0x7fffffffffffffffffffffffffffffff_int>);
+    }
+}
@@ -0,0 +1,105 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/comp/queue.hpp>
+#include <hmpc/expr/crypto/cipher.hpp>
+#include <hmpc/expr/tensor.hpp>
+#include <hmpc/ints/bigint.hpp>
+#include <hmpc/net/cipher.hpp>
+
+#include <array>
+#include <optional>
+#include <thread>
+#include <vector>
+
+constexpr auto config = "tests/mpc.yaml";
+
+TEST_CASE("Network: Encrypt and broadcast", "[net][queue][ffi][broadcast][cipher]")
+{
+    static constexpr hmpc::net::communicator<0, 1, 2, 3> communicator = {};
+    static constexpr hmpc::size chunk_size = 16;
+
+    using uint = hmpc::ints::ubigint<127>;
+    using limb = uint::limb_type;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto queues = std::make_tuple(
+        hmpc::net::queue<0>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<1>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<2>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<3>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<4>(hmpc::net::config::read_env(config)) // not part of the communicator
+    );
+
+    auto shape = hmpc::shape{41}; // three chunks, the last one only partially filled
+
+    auto x = hmpc::comp::make_tensor<uint>(shape);
+    {
+        hmpc::comp::host_accessor x_access(x, hmpc::access::discard_write);
+        for (hmpc::size i = 0; i < shape.size(); ++i)
+        {
+            x_access[i] = hmpc::ints::num::bit_copy<uint>(hmpc::core::size_limb_span<limb>{i});
+        }
+    }
+
+    hmpc::core::limb_array<hmpc::default_random_engine::key_size, hmpc::default_random_engine::value_type> key = {42};
+    hmpc::core::limb_array<hmpc::default_random_engine::nonce_size, hmpc::default_random_engine::value_type> nonce = {1};
+    auto cipher = hmpc::expr::crypto::cipher(key.span(hmpc::access::read), nonce.span(hmpc::access::read));
+
+    using ciphertext_type = decltype(queue(hmpc::expr::crypto::enc(cipher, hmpc::expr::tensor(x))));
+    std::array<std::optional<ciphertext_type>, communicator.size> ciphertexts;
+
+    // scope for threads
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(communicator.size + 1);
+
+        hmpc::iter::for_range<communicator.size + 1>([&](auto i)
+        {
+            threads.emplace_back(
+                std::jthread([&, i]()
+                {
+                    if constexpr (i < communicator.size)
+                    {
+                        ciphertexts[i] = hmpc::net::broadcast_encrypted<uint, hmpc::default_random_engine, chunk_size>(std::get<i>(queues), communicator, hmpc::party_constant_of<4>, shape);
+                    }
+                    else
+                    {
+                        hmpc::net::broadcast_encrypted<chunk_size>(std::get<i>(queues), queue.sycl_queue, communicator, hmpc::party_constant_of<4>, cipher, x);
+                    }
+                })
+            );
+        });
+    }
+
+    // the chunked ciphertext is the same as the ciphertext of `enc`
+    auto expected = queue(hmpc::expr::crypto::enc(cipher, hmpc::expr::tensor(x)));
+    hmpc::comp::host_accessor expected_access(expected, hmpc::access::read);
+
+    for (hmpc::size i = 0; i < communicator.size; ++i)
+    {
+        REQUIRE(ciphertexts[i].has_value());
+        auto& ciphertext = ciphertexts[i].value();
+
+        {
+            hmpc::comp::host_accessor ciphertext_access(ciphertext, hmpc::access::read);
+            for (hmpc::size j = 0; j < shape.size() * uint::limb_size; ++j)
+            {
+                CHECK(ciphertext_access[j] == expected_access[j]);
+            }
+        }
+
+        auto x_again = queue(hmpc::expr::crypto::dec<uint>(cipher, hmpc::expr::tensor(ciphertext)));
+
+        hmpc::comp::host_accessor x_access(x_again, hmpc::access::read);
+        for (hmpc::size j = 0; j < shape.size(); ++j)
+        {
+            CHECK(x_access[j] == hmpc::ints::num::bit_copy<uint>(hmpc::core::size_limb_span<limb>{j}));
+        }
+    }
+
+#ifdef HMPC_ENABLE_STATISTICS
+    CHECK(std::get<0>(queues).stats() == hmpc::net::statistics{.sent = 0, .received = 656, .rounds = 3});
+    CHECK(std::get<4>(queues).stats() == hmpc::net::statistics{.sent = 2624, .received = 0, .rounds = 3});
+#endif
+}
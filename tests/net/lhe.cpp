@@ -0,0 +1,130 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/comp/queue.hpp>
+#include <hmpc/expr/crypto/lhe/dec.hpp>
+#include <hmpc/expr/crypto/lhe/enc.hpp>
+#include <hmpc/ints/literals.hpp>
+#include <hmpc/ints/poly_mod.hpp>
+#include <hmpc/net/lhe.hpp>
+
+#include <array>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+constexpr auto config = "tests/mpc.yaml";
+
+TEST_CASE("Network: Distributed decryption", "[net][queue][ffi][all_gather][lhe]")
+{
+    using namespace hmpc::ints::literals;
+
+    static constexpr hmpc::net::communicator<0, 1, 2> communicator = {};
+
+    constexpr auto p = 0x8822'd806'2332'0001_int;                                                                     // 9809640459238244353
+    constexpr auto q = 0x59'1f5b'834c'0d96'1f67'343b'cc89'02bd'eda2'771f'5430'6ff1'5116'2ff8'd2b4'0f41'94dc'0001_int; // 676310504550516370745208338938566342426856908484397554505023779011987369401721290753
+    constexpr auto N = hmpc::size{1} << 12;
+
+    using Rq = hmpc::ints::poly_mod<q, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rq = hmpc::ints::traits::number_theoretic_transform_type_t<Rq>;
+    using mod_q = Rq::element_type;
+    using limb = mod_q::limb_type;
+
+    using Rp = hmpc::ints::poly_mod<p, N, hmpc::ints::coefficient_representation>;
+    using ntt_Rp = hmpc::ints::traits::number_theoretic_transform_type_t<Rp>;
+    using mod_p = Rp::element_type;
+
+    using plaintext = ntt_Rp;
+
+    // the noise of fresh ciphertexts is v - s * w with |v|, |w| <= 20 and s = 3
+    constexpr auto noise_bound = hmpc::constant_of<81_int>;
+
+    hmpc::comp::queue queue{sycl::queue(sycl::cpu_selector_v)};
+
+    auto queues = std::make_tuple(
+        hmpc::net::queue<0>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<1>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<2>(hmpc::net::config::read_env(config))
+    );
+
+    auto shape = hmpc::shape{4, 2};
+
+    // each party holds the key share 1, i.e., the secret key is s = 3 and a = s * b
+    auto a = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+    auto b = hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{});
+    {
+        hmpc::comp::host_accessor a_access(a, hmpc::access::discard_write);
+        hmpc::comp::host_accessor b_access(b, hmpc::access::discard_write);
+        for (hmpc::size i : std::views::iota(hmpc::size{}, N))
+        {
+            auto value = hmpc::ints::num::bit_copy<mod_q>(hmpc::core::size_limb_span<limb>(i));
+            b_access[i] = value;
+            a_access[i] = value + value + value;
+        }
+    }
+    std::array key_shares
+    {
+        hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{}),
+        hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{}),
+        hmpc::comp::make_tensor<ntt_Rq>(hmpc::shape{}),
+    };
+    for (auto& key_share : key_shares)
+    {
+        hmpc::comp::host_accessor access(key_share, hmpc::access::discard_write);
+        for (hmpc::size i : std::views::iota(hmpc::size{}, N))
+        {
+            access[i] = hmpc::ints::integer_traits<mod_q>::one;
+        }
+    }
+
+    auto k = hmpc::comp::crypto::lhe::key{a, b};
+
+    auto x = hmpc::comp::make_tensor<plaintext>(shape);
+    for (hmpc::comp::host_accessor access(x, hmpc::access::discard_write); hmpc::size i : std::views::iota(hmpc::size{}, 4 * 2 * N))
+    {
+        access[i] = hmpc::ints::num::bit_copy<mod_p>(hmpc::core::size_limb_span<limb>(i));
+    }
+
+    auto c = queue(hmpc::expr::crypto::lhe::enc(hmpc::expr::crypto::lhe::key(k), hmpc::expr::tensor(x), hmpc::expr::crypto::lhe::randomness<Rq>(shape)));
+
+    using plaintext_type = decltype(queue(hmpc::expr::tensor(x)));
+    std::array<std::optional<plaintext_type>, communicator.size> results;
+
+    // scope for threads
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(communicator.size);
+
+        hmpc::iter::for_range<communicator.size>([&](auto i)
+        {
+            threads.emplace_back(
+                std::jthread([&, i]()
+                {
+                    hmpc::comp::queue party_queue{sycl::queue(sycl::cpu_selector_v)};
+                    auto key_share = hmpc::comp::mpc::share<hmpc::comp::tensor<ntt_Rq>, communicator.get(i), 0, 1, 2>{key_shares[i]};
+                    results[i] = hmpc::net::distributed_dec<plaintext>(std::get<i>(queues), party_queue, key_share, c, noise_bound);
+                })
+            );
+        });
+    }
+
+    hmpc::comp::host_accessor x_access(x, hmpc::access::read);
+    for (hmpc::size i = 0; i < communicator.size; ++i)
+    {
+        REQUIRE(results[i].has_value());
+
+        hmpc::comp::host_accessor access(results[i].value(), hmpc::access::read);
+        for (hmpc::size j = 0; j < 4 * 2 * N; ++j)
+        {
+            CHECK(access[j] == x_access[j]);
+        }
+    }
+
+#ifdef HMPC_ENABLE_STATISTICS
+    // every party sends its share (4 * 2 polynomials in R_q) to both other parties
+    constexpr hmpc::size share_size = 4 * 2 * N * mod_q::limb_size * sizeof(limb);
+    CHECK(std::get<0>(queues).stats() == hmpc::net::statistics{.sent = 2 * share_size, .received = 2 * share_size, .rounds = 1});
+    CHECK(std::get<1>(queues).stats() == hmpc::net::statistics{.sent = 2 * share_size, .received = 2 * share_size, .rounds = 1});
+    CHECK(std::get<2>(queues).stats() == hmpc::net::statistics{.sent = 2 * share_size, .received = 2 * share_size, .rounds = 1});
+#endif
+}
@@ -83,6 +83,75 @@ TEST_CASE("Network: Broadcast", "[net][queue][ffi][broadcast]")
 #endif
 }
 
+TEST_CASE("Network: Broadcast with 64-bit limbs", "[net][queue][ffi][broadcast]")
+{
+    static constexpr hmpc::net::communicator<0, 1, 2> communicator = {};
+
+    using uint = hmpc::ints::ubigint<128, hmpc::core::uint64>;
+    static_assert(uint::limb_size == 2);
+
+    auto queues = std::make_tuple(
+        hmpc::net::queue<0>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<1>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<2>(hmpc::net::config::read_env(config)),
+        hmpc::net::queue<3>(hmpc::net::config::read_env(config)) // not part of the communicator
+    );
+
+    auto shape = hmpc::shape{2};
+
+    auto data = std::array
+    {
+        hmpc::comp::make_tensor<uint>(shape),
+        hmpc::comp::make_tensor<uint>(shape),
+        hmpc::comp::make_tensor<uint>(shape),
+        hmpc::comp::make_tensor<uint>(shape),
+    };
+
+    // Party 3 sends data (with both halves of every limb set to detect truncation or swapped words)
+    {
+        hmpc::comp::host_accessor access(data[3], hmpc::access::discard_write);
+        access[0] = uint{0x0123'4567'89ab'cdef, 0xfedc'ba98'7654'3210};
+        access[1] = uint{0x1111'2222'3333'4444, 0x5555'6666'7777'8888};
+    }
+
+    // scope for threads
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(communicator.size + 1);
+
+        hmpc::iter::for_range<communicator.size + 1>([&](auto i)
+        {
+            threads.emplace_back(
+                std::jthread([&, i]()
+                {
+                    if constexpr (i < communicator.size)
+                    {
+                        data[i] = std::get<i>(queues).template broadcast<uint>(communicator, hmpc::party_constant_of<3>, shape);
+                    }
+                    else
+                    {
+                        std::get<i>(queues).broadcast(communicator, hmpc::party_constant_of<3>, data[i]);
+                    }
+                })
+            );
+        });
+    }
+
+    for (hmpc::size i = 0; i < communicator.size + 1; ++i)
+    {
+        hmpc::comp::host_accessor access(data[i], hmpc::access::read);
+        CHECK(access[0] == uint{0x0123'4567'89ab'cdef, 0xfedc'ba98'7654'3210});
+        CHECK(access[1] == uint{0x1111'2222'3333'4444, 0x5555'6666'7777'8888});
+    }
+
+#ifdef HMPC_ENABLE_STATISTICS
+    CHECK(std::get<0>(queues).stats() == hmpc::net::statistics{.sent = 0, .received = 32, .rounds = 1});
+    CHECK(std::get<1>(queues).stats() == hmpc::net::statistics{.sent = 0, .received = 32, .rounds = 1});
+    CHECK(std::get<2>(queues).stats() == hmpc::net::statistics{.sent = 0, .received = 32, .rounds = 1});
+    CHECK(std::get<3>(queues).stats() == hmpc::net::statistics{.sent = 96, .received = 0, .rounds = 1});
+#endif
+}
+
 TEST_CASE("Network: Gather", "[net][queue][ffi][gather]")
 {
     static constexpr hmpc::net::communicator<10, 11, 12, 13> communicator = {};
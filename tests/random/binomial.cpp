@@ -1,5 +1,6 @@
 #include "catch_helpers.hpp"
 
+#include <hmpc/core/num/popcount.hpp>
 #include <hmpc/ints/numeric.hpp>
 #include <hmpc/random/binomial.hpp>
 #include <hmpc/random/number_generator.hpp>
@@ -55,3 +56,21 @@ TEST_CASE("Binomial", "[random]")
         CHECK(abs(e) <= hmpc::ints::ubigint<1>{1});
     }
 }
+
+TEST_CASE("Binomial popcount", "[random]")
+{
+    auto rng = hmpc::random::compiletime_number_generator();
+
+    for (int i = 0; i < 1'000; ++i)
+    {
+        hmpc::core::bit_array<100, hmpc::default_limb, hmpc::without_sign> bits;
+        rng.uniform(bits.span(hmpc::access::write));
+
+        hmpc::size expected = 0;
+        for (hmpc::size j = 0; j < 100; ++j)
+        {
+            expected += (bits[j / 32].data >> (j % 32)) & 1;
+        }
+        CHECK(hmpc::core::num::popcount(bits.span(hmpc::access::read)) == expected);
+    }
+}
@@ -0,0 +1,53 @@
+#include "catch_helpers.hpp"
+
+#include <hmpc/ints/numeric.hpp>
+#include <hmpc/random/discrete_gaussian.hpp>
+#include <hmpc/random/number_generator.hpp>
+
+#include <cmath>
+
+TEST_CASE("Discrete Gaussian", "[random]")
+{
+    auto rng = hmpc::random::compiletime_number_generator();
+
+    using limits = hmpc::random::discrete_gaussian_limits<hmpc::rational_size{16, 5}, decltype(rng)>; // sigma = 3.2
+
+    // Pr[|X| > 34] < 2^-80 (the default statistical security)
+    REQUIRE(limits::precision >= 80);
+    REQUIRE(limits::tail == 34);
+    REQUIRE(limits::bit_size == 7);
+    REQUIRE(limits::max == hmpc::ints::ubigint<6>{34});
+    REQUIRE(limits::min == -hmpc::ints::ubigint<6>{34});
+
+    // the tail grows with the statistical security (and is not limited by 64 bits of precision)
+    using limits_64 = hmpc::random::discrete_gaussian_limits<hmpc::rational_size{16, 5}, decltype(rng), hmpc::statistical_security{64}>;
+    STATIC_REQUIRE(limits_64::precision == 64);
+    STATIC_REQUIRE(limits_64::tail == 29);
+    using limits_128 = hmpc::random::discrete_gaussian_limits<hmpc::rational_size{16, 5}, decltype(rng), hmpc::statistical_security{128}>;
+    STATIC_REQUIRE(limits_128::precision == 128);
+    STATIC_REQUIRE(limits_128::tail == 42);
+
+    for (hmpc::size k = 1; k < limits::tail; ++k)
+    {
+        CHECK(limits::table[k - 1] <= limits::table[k]);
+    }
+
+    constexpr int samples = 100'000;
+    double sum = 0;
+    double sum_of_squares = 0;
+    for (int i = 0; i < samples; ++i)
+    {
+        auto x = hmpc::random::discrete_gaussian(rng, hmpc::rational_size_constant_of<16, 5>);
+        REQUIRE(hmpc::is_signed(x.signedness));
+        REQUIRE(x.bit_size == 7);
+        CHECK(limits::min.value <= x);
+        CHECK(x <= limits::max.value);
+
+        auto magnitude = static_cast<double>(abs(x).data[0].data);
+        sum += (x < hmpc::ints::zero<>) ? -magnitude : magnitude;
+        sum_of_squares += magnitude * magnitude;
+    }
+
+    CHECK(std::abs(sum / samples) < 0.1);
+    CHECK(std::abs(sum_of_squares / samples - 3.2 * 3.2) < 0.3);
+}
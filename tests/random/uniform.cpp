@@ -50,4 +50,57 @@ TEST_CASE("Uniform", "[random]")
         auto x = hmpc::random::uniform<mod_p>(rng);
         REQUIRE(x.modulus == p);
     }
+
+    SECTION("Rejection sampled integer modulo")
+    {
+        constexpr auto p = 0xffffffff00000001_int; // 2^64 - 2^32 + 1
+
+        using mod_p = hmpc::ints::mod<p>;
+        using limits = hmpc::random::rejection_uniform_limits<mod_p>;
+
+        STATIC_REQUIRE(limits::bit_count == 64);
+        STATIC_REQUIRE(limits::gap == 32);
+        STATIC_REQUIRE(limits::attempts == 3);
+
+        for (int i = 0; i < 1'000; ++i)
+        {
+            auto x = hmpc::random::rejection_uniform<mod_p>(rng);
+            REQUIRE(x.modulus == p);
+            CHECK(hmpc::ints::num::less(x, mod_p::modulus));
+        }
+    }
+
+    SECTION("Rejection sampled integer modulo with rejections")
+    {
+        constexpr auto p = 0x1'0000'0000'0000'000d_int; // 2^64 + 13, i.e., about half of all candidates are rejected
+
+        using mod_p = hmpc::ints::mod<p>;
+        using limits = hmpc::random::rejection_uniform_limits<mod_p>;
+
+        STATIC_REQUIRE(limits::bit_count == 65);
+        STATIC_REQUIRE(limits::gap == 1);
+        STATIC_REQUIRE(limits::attempts == static_cast<hmpc::size>(hmpc::default_statistical_security));
+
+        auto other_rng = hmpc::random::compiletime_number_generator();
+        auto reference_rng = hmpc::random::compiletime_number_generator();
+
+        hmpc::size rejections = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            auto x = hmpc::random::rejection_uniform<mod_p>(rng);
+            // same seed, same values
+            REQUIRE(x == hmpc::random::rejection_uniform<mod_p>(other_rng));
+
+            // the first candidate below the modulus is accepted
+            mod_p::unsigned_type candidate;
+            reference_rng.uniform(candidate.span(hmpc::access::write));
+            while (not hmpc::bool_cast(hmpc::ints::num::less(candidate, mod_p::modulus)))
+            {
+                ++rejections;
+                reference_rng.uniform(candidate.span(hmpc::access::write));
+            }
+            REQUIRE(x == mod_p(candidate, hmpc::ints::from_reduced_uniformly_random));
+        }
+        CHECK(rejections > 0);
+    }
 }